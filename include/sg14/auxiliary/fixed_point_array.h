@@ -0,0 +1,1350 @@
+
+//          Copyright John McFarlane 2015 - 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief element-wise arithmetic on arrays of `sg14::fixed_point` values using SIMD instructions
+
+#if !defined(SG14_FIXED_POINT_ARRAY_H)
+#define SG14_FIXED_POINT_ARRAY_H 1
+
+#include <sg14/bits/config.h>
+#include <sg14/fixed_point>
+
+#include "safe_integer.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(SG14_SIMD_DISPATCH_ENABLED) || defined(SG14_AVX2_ENABLED)
+#include <immintrin.h>
+#elif defined(SG14_SSE2_ENABLED)
+#include <emmintrin.h>
+#endif
+
+#if defined(SG14_SIMD_TARGET)
+#error SG14_SIMD_TARGET already defined
+#endif
+
+#if defined(SG14_SIMD_INLINE)
+#error SG14_SIMD_INLINE already defined
+#endif
+
+#if defined(SG14_SIMD_DISPATCH_ENABLED)
+// kernels are compiled for instruction sets which the compiler does not target;
+// functions which are common to all instruction sets are inlined into the kernels of each
+#define SG14_SIMD_TARGET(isa) __attribute__((target(isa)))
+#define SG14_SIMD_INLINE __attribute__((always_inline)) inline
+#else
+#define SG14_SIMD_TARGET(isa)
+#define SG14_SIMD_INLINE inline
+#endif
+
+/// study group 14 of the C++ working group
+namespace sg14 {
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::simd_level
+
+    /// \brief instruction sets with which the kernels of \ref transform_add and related functions are calculated
+    /// \headerfile sg14/auxiliary/fixed_point_array.h
+    ///
+    /// Levels are ordered such that each uses instructions which are supported by processors supporting the next.
+    ///
+    /// \sa get_simd_level, set_simd_level
+    enum class simd_level {
+        /// elements are calculated by the scalar operators
+        none,
+        /// 128-bit registers
+        sse2,
+        /// 128-bit registers and 32-bit multiplication
+        sse41,
+        /// 256-bit registers
+        avx2,
+        /// 512-bit registers (AVX-512F and AVX-512BW)
+        avx512
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // implementation-specific definitions
+
+    namespace _impl {
+        namespace fp {
+            namespace simd {
+                ////////////////////////////////////////////////////////////////////////////////
+                // lanes
+
+                // true iff Rep is a built-in integer which can occupy a lane of a SIMD register
+                template<class Rep>
+                struct is_lane_rep : std::integral_constant<bool,
+                        std::is_integral<Rep>::value && !std::is_same<Rep, bool>::value && sizeof(Rep)<=4> {
+                };
+
+                // lane width in bytes
+                template<int Bytes>
+                using lane = std::integral_constant<int, Bytes>;
+
+                // true iff products of Rep shifted right by Shift places (or left, if negative) are calculated exactly;
+                // products of 8-bit lanes are calculated in 16 bits and all others in 32 bits
+                template<class Rep>
+                constexpr bool is_lane_shift(int shift)
+                {
+                    return (sizeof(Rep)==1) ? (shift>-16 && shift<16) : (shift>-31 && shift<31);
+                }
+
+                // places by which a product is shifted to give the result;
+                // one of the two is always zero
+                struct product_shift {
+                    int left;
+                    int right;
+                };
+
+                constexpr product_shift make_product_shift(int shift)
+                {
+                    return product_shift{(shift<0) ? -shift : 0, (shift>0) ? shift : 0};
+                }
+
+                // the reps of an array of fixed_point
+                template<class Rep, int Exponent>
+                Rep const* rep_data(fixed_point<Rep, Exponent> const* data)
+                {
+                    static_assert(sizeof(fixed_point<Rep, Exponent>)==sizeof(Rep), "fixed_point must have the layout of its rep");
+                    return reinterpret_cast<Rep const*>(data);
+                }
+
+                template<class Rep, int Exponent>
+                Rep* rep_data(fixed_point<Rep, Exponent>* data)
+                {
+                    static_assert(sizeof(fixed_point<Rep, Exponent>)==sizeof(Rep), "fixed_point must have the layout of its rep");
+                    return reinterpret_cast<Rep*>(data);
+                }
+
+                ////////////////////////////////////////////////////////////////////////////////
+                // saturated lanes
+
+                template<class Rep>
+                using saturated_integer = safe_integer<Rep, saturated_overflow_tag>;
+
+                // true iff Rep is a signed integer for whose lanes there are saturating instructions
+                template<class Rep>
+                struct is_saturated_lane_rep : std::integral_constant<bool,
+                        std::is_integral<Rep>::value && std::is_signed<Rep>::value && sizeof(Rep)<=2> {
+                };
+
+                // products which are shifted left may exceed the lanes in which they are calculated
+                // before they are saturated
+                template<class Rep>
+                constexpr bool is_saturated_lane_shift(int shift)
+                {
+                    return shift>=0 && is_lane_shift<Rep>(shift);
+                }
+
+                // the built-in integers underlying an array of fixed_point of saturated_integer
+                template<class Rep, int Exponent>
+                Rep const* rep_data(fixed_point<saturated_integer<Rep>, Exponent> const* data)
+                {
+                    static_assert(sizeof(fixed_point<saturated_integer<Rep>, Exponent>)==sizeof(Rep),
+                            "fixed_point must have the layout of its rep");
+                    return reinterpret_cast<Rep const*>(data);
+                }
+
+                template<class Rep, int Exponent>
+                Rep* rep_data(fixed_point<saturated_integer<Rep>, Exponent>* data)
+                {
+                    static_assert(sizeof(fixed_point<saturated_integer<Rep>, Exponent>)==sizeof(Rep),
+                            "fixed_point must have the layout of its rep");
+                    return reinterpret_cast<Rep*>(data);
+                }
+
+#if defined(SG14_SSE2_ENABLED)
+                ////////////////////////////////////////////////////////////////////////////////
+                // operations on whole registers
+                //
+                // each is common to all instruction sets, Isa, and calculates one register of elements;
+                // they are always inlined into kernels which target Isa, so registers are never passed
+                // between functions which target different instructions, despite warnings to the contrary
+#if defined(SG14_SIMD_DISPATCH_ENABLED) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+                template<class Rep>
+                struct add_operation {
+                    template<class Isa>
+                    SG14_SIMD_INLINE void apply(Rep const* lhs, Rep const* rhs, Rep* output) const
+                    {
+                        Isa::store(output, Isa::add(lane<sizeof(Rep)>{}, Isa::load(lhs), Isa::load(rhs)));
+                    }
+                };
+
+                template<class Rep>
+                struct subtract_operation {
+                    template<class Isa>
+                    SG14_SIMD_INLINE void apply(Rep const* lhs, Rep const* rhs, Rep* output) const
+                    {
+                        Isa::store(output, Isa::subtract(lane<sizeof(Rep)>{}, Isa::load(lhs), Isa::load(rhs)));
+                    }
+                };
+
+                template<class Rep>
+                struct multiply_operation {
+                    template<class Isa>
+                    SG14_SIMD_INLINE void apply(Rep const* lhs, Rep const* rhs, Rep* output) const
+                    {
+                        Isa::store(output, Isa::template multiply<Rep>(
+                                lane<sizeof(Rep)>{}, Isa::load(lhs), Isa::load(rhs), shift));
+                    }
+
+                    product_shift shift;
+                };
+
+                // the factor is broadcast inside the loop so that no register is passed into the kernel
+                template<class Rep>
+                struct scale_operation {
+                    template<class Isa>
+                    SG14_SIMD_INLINE void apply(Rep const* input, Rep* output) const
+                    {
+                        Isa::store(output, Isa::template multiply<Rep>(
+                                lane<sizeof(Rep)>{}, Isa::load(input), Isa::broadcast(lane<sizeof(Rep)>{}, factor), shift));
+                    }
+
+                    Rep factor;
+                    product_shift shift;
+                };
+
+                // results of signed Rep which do not fit are saturated, as with saturated_overflow_tag
+                template<class Rep>
+                struct saturated_add_operation {
+                    template<class Isa>
+                    SG14_SIMD_INLINE void apply(Rep const* lhs, Rep const* rhs, Rep* output) const
+                    {
+                        Isa::store(output, Isa::add_saturated(lane<sizeof(Rep)>{}, Isa::load(lhs), Isa::load(rhs)));
+                    }
+                };
+
+                template<class Rep>
+                struct saturated_subtract_operation {
+                    template<class Isa>
+                    SG14_SIMD_INLINE void apply(Rep const* lhs, Rep const* rhs, Rep* output) const
+                    {
+                        Isa::store(output, Isa::subtract_saturated(lane<sizeof(Rep)>{}, Isa::load(lhs), Isa::load(rhs)));
+                    }
+                };
+
+                template<class Rep>
+                struct saturated_multiply_operation {
+                    template<class Isa>
+                    SG14_SIMD_INLINE void apply(Rep const* lhs, Rep const* rhs, Rep* output) const
+                    {
+                        Isa::store(output, Isa::multiply_saturated(
+                                lane<sizeof(Rep)>{}, Isa::load(lhs), Isa::load(rhs), shift));
+                    }
+
+                    product_shift shift;
+                };
+
+                template<class Rep>
+                struct saturated_scale_operation {
+                    template<class Isa>
+                    SG14_SIMD_INLINE void apply(Rep const* input, Rep* output) const
+                    {
+                        Isa::store(output, Isa::multiply_saturated(
+                                lane<sizeof(Rep)>{}, Isa::load(input), Isa::broadcast(lane<sizeof(Rep)>{}, factor), shift));
+                    }
+
+                    Rep factor;
+                    product_shift shift;
+                };
+
+                // applies operation to as many whole registers of elements as there are
+                // and returns the number of elements which were calculated
+                template<class Isa, class Rep, class Operation>
+                SG14_SIMD_INLINE std::size_t transform_vectors(
+                        Rep const* lhs, Rep const* rhs, Rep* output, std::size_t size, Operation const& operation)
+                {
+                    constexpr auto lanes = sizeof(typename Isa::vector)/sizeof(Rep);
+                    auto whole = size-size%lanes;
+                    for (auto index = std::size_t{0}; index!=whole; index += lanes) {
+                        operation.template apply<Isa>(lhs+index, rhs+index, output+index);
+                    }
+                    return whole;
+                }
+
+                template<class Isa, class Rep, class Operation>
+                SG14_SIMD_INLINE std::size_t transform_vectors(
+                        Rep const* input, Rep* output, std::size_t size, Operation const& operation)
+                {
+                    constexpr auto lanes = sizeof(typename Isa::vector)/sizeof(Rep);
+                    auto whole = size-size%lanes;
+                    for (auto index = std::size_t{0}; index!=whole; index += lanes) {
+                        operation.template apply<Isa>(input+index, output+index);
+                    }
+                    return whole;
+                }
+
+#if defined(SG14_SIMD_DISPATCH_ENABLED) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+                ////////////////////////////////////////////////////////////////////////////////
+                // sg14::_impl::fp::simd::sse2
+
+                // instructions operating on 128-bit registers;
+                // results match those of the scalar operators, i.e. products are rounded toward zero
+                // and results which do not fit are wrapped
+                struct sse2 {
+                    using vector = __m128i;
+
+                    static vector load(void const* source)
+                    {
+                        return _mm_loadu_si128(static_cast<__m128i const*>(source));
+                    }
+
+                    static void store(void* destination, vector v)
+                    {
+                        _mm_storeu_si128(static_cast<__m128i*>(destination), v);
+                    }
+
+                    static vector broadcast(lane<1>, int value)
+                    {
+                        return _mm_set1_epi8(static_cast<char>(value));
+                    }
+
+                    static vector broadcast(lane<2>, int value)
+                    {
+                        return _mm_set1_epi16(static_cast<short>(value));
+                    }
+
+                    static vector broadcast(lane<4>, int value)
+                    {
+                        return _mm_set1_epi32(value);
+                    }
+
+                    static vector add(lane<1>, vector lhs, vector rhs)
+                    {
+                        return _mm_add_epi8(lhs, rhs);
+                    }
+
+                    static vector add(lane<2>, vector lhs, vector rhs)
+                    {
+                        return _mm_add_epi16(lhs, rhs);
+                    }
+
+                    static vector add(lane<4>, vector lhs, vector rhs)
+                    {
+                        return _mm_add_epi32(lhs, rhs);
+                    }
+
+                    static vector subtract(lane<1>, vector lhs, vector rhs)
+                    {
+                        return _mm_sub_epi8(lhs, rhs);
+                    }
+
+                    static vector subtract(lane<2>, vector lhs, vector rhs)
+                    {
+                        return _mm_sub_epi16(lhs, rhs);
+                    }
+
+                    static vector subtract(lane<4>, vector lhs, vector rhs)
+                    {
+                        return _mm_sub_epi32(lhs, rhs);
+                    }
+
+                    // signed values are shifted right with a bias so that they are rounded toward zero
+                    static vector shift16(std::true_type, vector product, product_shift shift)
+                    {
+                        auto shifted = _mm_sll_epi16(product, _mm_cvtsi32_si128(shift.left));
+                        auto bias = _mm_srl_epi16(_mm_srai_epi16(shifted, 15), _mm_cvtsi32_si128(16-shift.right));
+                        return _mm_sra_epi16(_mm_add_epi16(shifted, bias), _mm_cvtsi32_si128(shift.right));
+                    }
+
+                    static vector shift16(std::false_type, vector product, product_shift shift)
+                    {
+                        return _mm_srl_epi16(_mm_sll_epi16(product, _mm_cvtsi32_si128(shift.left)), _mm_cvtsi32_si128(shift.right));
+                    }
+
+                    static vector shift32(std::true_type, vector product, product_shift shift)
+                    {
+                        auto shifted = _mm_sll_epi32(product, _mm_cvtsi32_si128(shift.left));
+                        auto bias = _mm_srl_epi32(_mm_srai_epi32(shifted, 31), _mm_cvtsi32_si128(32-shift.right));
+                        return _mm_sra_epi32(_mm_add_epi32(shifted, bias), _mm_cvtsi32_si128(shift.right));
+                    }
+
+                    static vector shift32(std::false_type, vector product, product_shift shift)
+                    {
+                        return _mm_srl_epi32(_mm_sll_epi32(product, _mm_cvtsi32_si128(shift.left)), _mm_cvtsi32_si128(shift.right));
+                    }
+
+                    // low bytes of the 16-bit lanes of low and high
+                    static vector narrow16(vector low, vector high)
+                    {
+                        return _mm_packus_epi16(
+                                _mm_and_si128(low, _mm_set1_epi16(0xff)),
+                                _mm_and_si128(high, _mm_set1_epi16(0xff)));
+                    }
+
+                    // low halves of the 32-bit lanes of low and high, sign-extended so that packing does not saturate
+                    static vector narrow32(vector low, vector high)
+                    {
+                        return _mm_packs_epi32(
+                                _mm_srai_epi32(_mm_slli_epi32(low, 16), 16),
+                                _mm_srai_epi32(_mm_slli_epi32(high, 16), 16));
+                    }
+
+                    // the products of 8-bit values need no more than 16 bits;
+                    // those of unsigned values are not negative
+                    template<class Rep>
+                    static vector multiply(lane<1>, vector lhs, vector rhs, product_shift shift)
+                    {
+                        auto is_signed = std::integral_constant<bool, std::is_signed<Rep>::value>{};
+                        auto lhs_extension = is_signed ? _mm_cmpgt_epi8(_mm_setzero_si128(), lhs) : _mm_setzero_si128();
+                        auto rhs_extension = is_signed ? _mm_cmpgt_epi8(_mm_setzero_si128(), rhs) : _mm_setzero_si128();
+                        return narrow16(
+                                shift16(is_signed, _mm_mullo_epi16(
+                                        _mm_unpacklo_epi8(lhs, lhs_extension),
+                                        _mm_unpacklo_epi8(rhs, rhs_extension)), shift),
+                                shift16(is_signed, _mm_mullo_epi16(
+                                        _mm_unpackhi_epi8(lhs, lhs_extension),
+                                        _mm_unpackhi_epi8(rhs, rhs_extension)), shift));
+                    }
+
+                    // the products of 16-bit values are of type, int
+                    template<class Rep>
+                    static vector multiply(lane<2>, vector lhs, vector rhs, product_shift shift)
+                    {
+                        auto low = _mm_mullo_epi16(lhs, rhs);
+                        auto high = std::is_signed<Rep>::value ? _mm_mulhi_epi16(lhs, rhs) : _mm_mulhi_epu16(lhs, rhs);
+                        return narrow32(
+                                shift32(std::true_type{}, _mm_unpacklo_epi16(low, high), shift),
+                                shift32(std::true_type{}, _mm_unpackhi_epi16(low, high), shift));
+                    }
+
+                    // there is no instruction to multiply four 32-bit lanes so even and odd lanes are multiplied separately
+                    template<class Rep>
+                    static vector multiply(lane<4>, vector lhs, vector rhs, product_shift shift)
+                    {
+                        auto even = _mm_mul_epu32(lhs, rhs);
+                        auto odd = _mm_mul_epu32(_mm_srli_epi64(lhs, 32), _mm_srli_epi64(rhs, 32));
+                        auto product = _mm_unpacklo_epi32(
+                                _mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+                        return shift32(std::integral_constant<bool, std::is_signed<Rep>::value>{}, product, shift);
+                    }
+
+                    // results which do not fit in signed lanes are saturated
+                    static vector add_saturated(lane<1>, vector lhs, vector rhs)
+                    {
+                        return _mm_adds_epi8(lhs, rhs);
+                    }
+
+                    static vector add_saturated(lane<2>, vector lhs, vector rhs)
+                    {
+                        return _mm_adds_epi16(lhs, rhs);
+                    }
+
+                    static vector subtract_saturated(lane<1>, vector lhs, vector rhs)
+                    {
+                        return _mm_subs_epi8(lhs, rhs);
+                    }
+
+                    static vector subtract_saturated(lane<2>, vector lhs, vector rhs)
+                    {
+                        return _mm_subs_epi16(lhs, rhs);
+                    }
+
+                    // products are rounded toward zero, as are those of the scalar operators, and saturated as they are packed
+                    static vector multiply_saturated(lane<1>, vector lhs, vector rhs, product_shift shift)
+                    {
+                        auto lhs_extension = _mm_cmpgt_epi8(_mm_setzero_si128(), lhs);
+                        auto rhs_extension = _mm_cmpgt_epi8(_mm_setzero_si128(), rhs);
+                        return _mm_packs_epi16(
+                                shift16(std::true_type{}, _mm_mullo_epi16(
+                                        _mm_unpacklo_epi8(lhs, lhs_extension),
+                                        _mm_unpacklo_epi8(rhs, rhs_extension)), shift),
+                                shift16(std::true_type{}, _mm_mullo_epi16(
+                                        _mm_unpackhi_epi8(lhs, lhs_extension),
+                                        _mm_unpackhi_epi8(rhs, rhs_extension)), shift));
+                    }
+
+                    static vector multiply_saturated(lane<2>, vector lhs, vector rhs, product_shift shift)
+                    {
+                        auto low = _mm_mullo_epi16(lhs, rhs);
+                        auto high = _mm_mulhi_epi16(lhs, rhs);
+                        return _mm_packs_epi32(
+                                shift32(std::true_type{}, _mm_unpacklo_epi16(low, high), shift),
+                                shift32(std::true_type{}, _mm_unpackhi_epi16(low, high), shift));
+                    }
+
+                    // kernels; see transform_vectors
+                    template<class Rep, class Operation>
+                    static std::size_t transform_array(
+                            Rep const* lhs, Rep const* rhs, Rep* output, std::size_t size, Operation operation)
+                    {
+                        return transform_vectors<sse2>(lhs, rhs, output, size, operation);
+                    }
+
+                    template<class Rep, class Operation>
+                    static std::size_t transform_array(Rep const* input, Rep* output, std::size_t size, Operation operation)
+                    {
+                        return transform_vectors<sse2>(input, output, size, operation);
+                    }
+                };
+#endif
+
+#if defined(SG14_SIMD_DISPATCH_ENABLED)
+                ////////////////////////////////////////////////////////////////////////////////
+                // sg14::_impl::fp::simd::sse41
+
+                // instructions of sse2 and SSE4.1, which multiplies 32-bit lanes and packs them without saturation
+                struct sse41 : sse2 {
+                    using sse2::multiply;
+
+                    template<class Rep>
+                    SG14_SIMD_TARGET("sse4.1")
+                    static vector multiply(lane<2>, vector lhs, vector rhs, product_shift shift)
+                    {
+                        auto low = _mm_mullo_epi16(lhs, rhs);
+                        auto high = std::is_signed<Rep>::value ? _mm_mulhi_epi16(lhs, rhs) : _mm_mulhi_epu16(lhs, rhs);
+                        auto mask = _mm_set1_epi32(0xffff);
+                        return _mm_packus_epi32(
+                                _mm_and_si128(shift32(std::true_type{}, _mm_unpacklo_epi16(low, high), shift), mask),
+                                _mm_and_si128(shift32(std::true_type{}, _mm_unpackhi_epi16(low, high), shift), mask));
+                    }
+
+                    template<class Rep>
+                    SG14_SIMD_TARGET("sse4.1")
+                    static vector multiply(lane<4>, vector lhs, vector rhs, product_shift shift)
+                    {
+                        return shift32(std::integral_constant<bool, std::is_signed<Rep>::value>{},
+                                _mm_mullo_epi32(lhs, rhs), shift);
+                    }
+
+                    // kernels; see transform_vectors
+                    template<class Rep, class Operation>
+                    SG14_SIMD_TARGET("sse4.1")
+                    static std::size_t transform_array(
+                            Rep const* lhs, Rep const* rhs, Rep* output, std::size_t size, Operation operation)
+                    {
+                        return transform_vectors<sse41>(lhs, rhs, output, size, operation);
+                    }
+
+                    template<class Rep, class Operation>
+                    SG14_SIMD_TARGET("sse4.1")
+                    static std::size_t transform_array(Rep const* input, Rep* output, std::size_t size, Operation operation)
+                    {
+                        return transform_vectors<sse41>(input, output, size, operation);
+                    }
+                };
+#endif
+
+#if defined(SG14_SIMD_DISPATCH_ENABLED) || defined(SG14_AVX2_ENABLED)
+                ////////////////////////////////////////////////////////////////////////////////
+                // sg14::_impl::fp::simd::avx2
+
+                // instructions operating on 256-bit registers; see sse2;
+                // unpacking and packing both work within 128-bit halves so elements keep their order
+                struct avx2 {
+                    using vector = __m256i;
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector load(void const* source)
+                    {
+                        return _mm256_loadu_si256(static_cast<__m256i const*>(source));
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static void store(void* destination, vector v)
+                    {
+                        _mm256_storeu_si256(static_cast<__m256i*>(destination), v);
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector broadcast(lane<1>, int value)
+                    {
+                        return _mm256_set1_epi8(static_cast<char>(value));
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector broadcast(lane<2>, int value)
+                    {
+                        return _mm256_set1_epi16(static_cast<short>(value));
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector broadcast(lane<4>, int value)
+                    {
+                        return _mm256_set1_epi32(value);
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector add(lane<1>, vector lhs, vector rhs)
+                    {
+                        return _mm256_add_epi8(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector add(lane<2>, vector lhs, vector rhs)
+                    {
+                        return _mm256_add_epi16(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector add(lane<4>, vector lhs, vector rhs)
+                    {
+                        return _mm256_add_epi32(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector subtract(lane<1>, vector lhs, vector rhs)
+                    {
+                        return _mm256_sub_epi8(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector subtract(lane<2>, vector lhs, vector rhs)
+                    {
+                        return _mm256_sub_epi16(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector subtract(lane<4>, vector lhs, vector rhs)
+                    {
+                        return _mm256_sub_epi32(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector shift16(std::true_type, vector product, product_shift shift)
+                    {
+                        auto shifted = _mm256_sll_epi16(product, _mm_cvtsi32_si128(shift.left));
+                        auto bias = _mm256_srl_epi16(_mm256_srai_epi16(shifted, 15), _mm_cvtsi32_si128(16-shift.right));
+                        return _mm256_sra_epi16(_mm256_add_epi16(shifted, bias), _mm_cvtsi32_si128(shift.right));
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector shift16(std::false_type, vector product, product_shift shift)
+                    {
+                        return _mm256_srl_epi16(_mm256_sll_epi16(product, _mm_cvtsi32_si128(shift.left)), _mm_cvtsi32_si128(shift.right));
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector shift32(std::true_type, vector product, product_shift shift)
+                    {
+                        auto shifted = _mm256_sll_epi32(product, _mm_cvtsi32_si128(shift.left));
+                        auto bias = _mm256_srl_epi32(_mm256_srai_epi32(shifted, 31), _mm_cvtsi32_si128(32-shift.right));
+                        return _mm256_sra_epi32(_mm256_add_epi32(shifted, bias), _mm_cvtsi32_si128(shift.right));
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector shift32(std::false_type, vector product, product_shift shift)
+                    {
+                        return _mm256_srl_epi32(_mm256_sll_epi32(product, _mm_cvtsi32_si128(shift.left)), _mm_cvtsi32_si128(shift.right));
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector narrow16(vector low, vector high)
+                    {
+                        return _mm256_packus_epi16(
+                                _mm256_and_si256(low, _mm256_set1_epi16(0xff)),
+                                _mm256_and_si256(high, _mm256_set1_epi16(0xff)));
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector narrow32(vector low, vector high)
+                    {
+                        return _mm256_packus_epi32(
+                                _mm256_and_si256(low, _mm256_set1_epi32(0xffff)),
+                                _mm256_and_si256(high, _mm256_set1_epi32(0xffff)));
+                    }
+
+                    template<class Rep>
+                    SG14_SIMD_TARGET("avx2")
+                    static vector multiply(lane<1>, vector lhs, vector rhs, product_shift shift)
+                    {
+                        auto is_signed = std::integral_constant<bool, std::is_signed<Rep>::value>{};
+                        auto lhs_extension = is_signed ? _mm256_cmpgt_epi8(_mm256_setzero_si256(), lhs) : _mm256_setzero_si256();
+                        auto rhs_extension = is_signed ? _mm256_cmpgt_epi8(_mm256_setzero_si256(), rhs) : _mm256_setzero_si256();
+                        return narrow16(
+                                shift16(is_signed, _mm256_mullo_epi16(
+                                        _mm256_unpacklo_epi8(lhs, lhs_extension),
+                                        _mm256_unpacklo_epi8(rhs, rhs_extension)), shift),
+                                shift16(is_signed, _mm256_mullo_epi16(
+                                        _mm256_unpackhi_epi8(lhs, lhs_extension),
+                                        _mm256_unpackhi_epi8(rhs, rhs_extension)), shift));
+                    }
+
+                    template<class Rep>
+                    SG14_SIMD_TARGET("avx2")
+                    static vector multiply(lane<2>, vector lhs, vector rhs, product_shift shift)
+                    {
+                        auto low = _mm256_mullo_epi16(lhs, rhs);
+                        auto high = std::is_signed<Rep>::value ? _mm256_mulhi_epi16(lhs, rhs) : _mm256_mulhi_epu16(lhs, rhs);
+                        return narrow32(
+                                shift32(std::true_type{}, _mm256_unpacklo_epi16(low, high), shift),
+                                shift32(std::true_type{}, _mm256_unpackhi_epi16(low, high), shift));
+                    }
+
+                    template<class Rep>
+                    SG14_SIMD_TARGET("avx2")
+                    static vector multiply(lane<4>, vector lhs, vector rhs, product_shift shift)
+                    {
+                        return shift32(std::integral_constant<bool, std::is_signed<Rep>::value>{},
+                                _mm256_mullo_epi32(lhs, rhs), shift);
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector add_saturated(lane<1>, vector lhs, vector rhs)
+                    {
+                        return _mm256_adds_epi8(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector add_saturated(lane<2>, vector lhs, vector rhs)
+                    {
+                        return _mm256_adds_epi16(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector subtract_saturated(lane<1>, vector lhs, vector rhs)
+                    {
+                        return _mm256_subs_epi8(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector subtract_saturated(lane<2>, vector lhs, vector rhs)
+                    {
+                        return _mm256_subs_epi16(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector multiply_saturated(lane<1>, vector lhs, vector rhs, product_shift shift)
+                    {
+                        auto lhs_extension = _mm256_cmpgt_epi8(_mm256_setzero_si256(), lhs);
+                        auto rhs_extension = _mm256_cmpgt_epi8(_mm256_setzero_si256(), rhs);
+                        return _mm256_packs_epi16(
+                                shift16(std::true_type{}, _mm256_mullo_epi16(
+                                        _mm256_unpacklo_epi8(lhs, lhs_extension),
+                                        _mm256_unpacklo_epi8(rhs, rhs_extension)), shift),
+                                shift16(std::true_type{}, _mm256_mullo_epi16(
+                                        _mm256_unpackhi_epi8(lhs, lhs_extension),
+                                        _mm256_unpackhi_epi8(rhs, rhs_extension)), shift));
+                    }
+
+                    SG14_SIMD_TARGET("avx2")
+                    static vector multiply_saturated(lane<2>, vector lhs, vector rhs, product_shift shift)
+                    {
+                        auto low = _mm256_mullo_epi16(lhs, rhs);
+                        auto high = _mm256_mulhi_epi16(lhs, rhs);
+                        return _mm256_packs_epi32(
+                                shift32(std::true_type{}, _mm256_unpacklo_epi16(low, high), shift),
+                                shift32(std::true_type{}, _mm256_unpackhi_epi16(low, high), shift));
+                    }
+
+                    // kernels; see transform_vectors
+                    template<class Rep, class Operation>
+                    SG14_SIMD_TARGET("avx2")
+                    static std::size_t transform_array(
+                            Rep const* lhs, Rep const* rhs, Rep* output, std::size_t size, Operation operation)
+                    {
+                        return transform_vectors<avx2>(lhs, rhs, output, size, operation);
+                    }
+
+                    template<class Rep, class Operation>
+                    SG14_SIMD_TARGET("avx2")
+                    static std::size_t transform_array(Rep const* input, Rep* output, std::size_t size, Operation operation)
+                    {
+                        return transform_vectors<avx2>(input, output, size, operation);
+                    }
+                };
+#endif
+
+#if defined(SG14_SIMD_DISPATCH_ENABLED)
+                ////////////////////////////////////////////////////////////////////////////////
+                // sg14::_impl::fp::simd::avx512
+
+                // instructions operating on 512-bit registers; see avx2;
+                // comparisons give masks rather than vectors so 8-bit lanes are widened by shifting
+                struct avx512 {
+                    using vector = __m512i;
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector load(void const* source)
+                    {
+                        return _mm512_loadu_si512(source);
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static void store(void* destination, vector v)
+                    {
+                        _mm512_storeu_si512(destination, v);
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector broadcast(lane<1>, int value)
+                    {
+                        return _mm512_set1_epi8(static_cast<char>(value));
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector broadcast(lane<2>, int value)
+                    {
+                        return _mm512_set1_epi16(static_cast<short>(value));
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector broadcast(lane<4>, int value)
+                    {
+                        return _mm512_set1_epi32(value);
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector add(lane<1>, vector lhs, vector rhs)
+                    {
+                        return _mm512_add_epi8(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector add(lane<2>, vector lhs, vector rhs)
+                    {
+                        return _mm512_add_epi16(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector add(lane<4>, vector lhs, vector rhs)
+                    {
+                        return _mm512_add_epi32(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector subtract(lane<1>, vector lhs, vector rhs)
+                    {
+                        return _mm512_sub_epi8(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector subtract(lane<2>, vector lhs, vector rhs)
+                    {
+                        return _mm512_sub_epi16(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector subtract(lane<4>, vector lhs, vector rhs)
+                    {
+                        return _mm512_sub_epi32(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector shift16(std::true_type, vector product, product_shift shift)
+                    {
+                        auto shifted = _mm512_sll_epi16(product, _mm_cvtsi32_si128(shift.left));
+                        auto bias = _mm512_srl_epi16(_mm512_srai_epi16(shifted, 15), _mm_cvtsi32_si128(16-shift.right));
+                        return _mm512_sra_epi16(_mm512_add_epi16(shifted, bias), _mm_cvtsi32_si128(shift.right));
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector shift16(std::false_type, vector product, product_shift shift)
+                    {
+                        return _mm512_srl_epi16(_mm512_sll_epi16(product, _mm_cvtsi32_si128(shift.left)), _mm_cvtsi32_si128(shift.right));
+                    }
+
+                    // shifts of 32-bit lanes are masked with every lane selected because, unmasked,
+                    // they merge into an undefined register which GCC warns may be used uninitialized
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector shift32(std::true_type, vector product, product_shift shift)
+                    {
+                        auto shifted = _mm512_maskz_sll_epi32(0xffff, product, _mm_cvtsi32_si128(shift.left));
+                        auto bias = _mm512_maskz_srl_epi32(0xffff,
+                                _mm512_maskz_srai_epi32(0xffff, shifted, 31), _mm_cvtsi32_si128(32-shift.right));
+                        return _mm512_maskz_sra_epi32(0xffff, _mm512_add_epi32(shifted, bias), _mm_cvtsi32_si128(shift.right));
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector shift32(std::false_type, vector product, product_shift shift)
+                    {
+                        return _mm512_maskz_srl_epi32(0xffff,
+                                _mm512_maskz_sll_epi32(0xffff, product, _mm_cvtsi32_si128(shift.left)),
+                                _mm_cvtsi32_si128(shift.right));
+                    }
+
+                    // bytes, each repeated in the high and low halves of a 16-bit lane, shifted into the low half
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector widen8(std::true_type, vector repeated)
+                    {
+                        return _mm512_srai_epi16(repeated, 8);
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector widen8(std::false_type, vector repeated)
+                    {
+                        return _mm512_srli_epi16(repeated, 8);
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector narrow16(vector low, vector high)
+                    {
+                        return _mm512_packus_epi16(
+                                _mm512_and_si512(low, _mm512_set1_epi16(0xff)),
+                                _mm512_and_si512(high, _mm512_set1_epi16(0xff)));
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector narrow32(vector low, vector high)
+                    {
+                        return _mm512_packus_epi32(
+                                _mm512_and_si512(low, _mm512_set1_epi32(0xffff)),
+                                _mm512_and_si512(high, _mm512_set1_epi32(0xffff)));
+                    }
+
+                    template<class Rep>
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector multiply(lane<1>, vector lhs, vector rhs, product_shift shift)
+                    {
+                        auto is_signed = std::integral_constant<bool, std::is_signed<Rep>::value>{};
+                        return narrow16(
+                                shift16(is_signed, _mm512_mullo_epi16(
+                                        widen8(is_signed, _mm512_unpacklo_epi8(lhs, lhs)),
+                                        widen8(is_signed, _mm512_unpacklo_epi8(rhs, rhs))), shift),
+                                shift16(is_signed, _mm512_mullo_epi16(
+                                        widen8(is_signed, _mm512_unpackhi_epi8(lhs, lhs)),
+                                        widen8(is_signed, _mm512_unpackhi_epi8(rhs, rhs))), shift));
+                    }
+
+                    template<class Rep>
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector multiply(lane<2>, vector lhs, vector rhs, product_shift shift)
+                    {
+                        auto low = _mm512_mullo_epi16(lhs, rhs);
+                        auto high = std::is_signed<Rep>::value ? _mm512_mulhi_epi16(lhs, rhs) : _mm512_mulhi_epu16(lhs, rhs);
+                        return narrow32(
+                                shift32(std::true_type{}, _mm512_unpacklo_epi16(low, high), shift),
+                                shift32(std::true_type{}, _mm512_unpackhi_epi16(low, high), shift));
+                    }
+
+                    template<class Rep>
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector multiply(lane<4>, vector lhs, vector rhs, product_shift shift)
+                    {
+                        return shift32(std::integral_constant<bool, std::is_signed<Rep>::value>{},
+                                _mm512_mullo_epi32(lhs, rhs), shift);
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector add_saturated(lane<1>, vector lhs, vector rhs)
+                    {
+                        return _mm512_adds_epi8(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector add_saturated(lane<2>, vector lhs, vector rhs)
+                    {
+                        return _mm512_adds_epi16(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector subtract_saturated(lane<1>, vector lhs, vector rhs)
+                    {
+                        return _mm512_subs_epi8(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector subtract_saturated(lane<2>, vector lhs, vector rhs)
+                    {
+                        return _mm512_subs_epi16(lhs, rhs);
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector multiply_saturated(lane<1>, vector lhs, vector rhs, product_shift shift)
+                    {
+                        return _mm512_packs_epi16(
+                                shift16(std::true_type{}, _mm512_mullo_epi16(
+                                        widen8(std::true_type{}, _mm512_unpacklo_epi8(lhs, lhs)),
+                                        widen8(std::true_type{}, _mm512_unpacklo_epi8(rhs, rhs))), shift),
+                                shift16(std::true_type{}, _mm512_mullo_epi16(
+                                        widen8(std::true_type{}, _mm512_unpackhi_epi8(lhs, lhs)),
+                                        widen8(std::true_type{}, _mm512_unpackhi_epi8(rhs, rhs))), shift));
+                    }
+
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static vector multiply_saturated(lane<2>, vector lhs, vector rhs, product_shift shift)
+                    {
+                        auto low = _mm512_mullo_epi16(lhs, rhs);
+                        auto high = _mm512_mulhi_epi16(lhs, rhs);
+                        return _mm512_packs_epi32(
+                                shift32(std::true_type{}, _mm512_unpacklo_epi16(low, high), shift),
+                                shift32(std::true_type{}, _mm512_unpackhi_epi16(low, high), shift));
+                    }
+
+                    // kernels; see transform_vectors
+                    template<class Rep, class Operation>
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static std::size_t transform_array(
+                            Rep const* lhs, Rep const* rhs, Rep* output, std::size_t size, Operation operation)
+                    {
+                        return transform_vectors<avx512>(lhs, rhs, output, size, operation);
+                    }
+
+                    template<class Rep, class Operation>
+                    SG14_SIMD_TARGET("avx512f,avx512bw")
+                    static std::size_t transform_array(Rep const* input, Rep* output, std::size_t size, Operation operation)
+                    {
+                        return transform_vectors<avx512>(input, output, size, operation);
+                    }
+                };
+#elif defined(SG14_SSE2_ENABLED)
+                // without dispatch, the instructions which the compiler targets serve every level
+                using sse41 = sse2;
+#if defined(SG14_AVX2_ENABLED)
+                using avx512 = avx2;
+#else
+                using avx2 = sse2;
+                using avx512 = sse2;
+#endif
+#endif
+
+                ////////////////////////////////////////////////////////////////////////////////
+                // levels
+
+                // the highest level supported by the processor or, without dispatch, targeted by the compiler
+                inline simd_level probe_simd_level()
+                {
+#if defined(SG14_SIMD_DISPATCH_ENABLED)
+                    __builtin_cpu_init();
+                    return (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) ? simd_level::avx512
+                            : __builtin_cpu_supports("avx2") ? simd_level::avx2
+                            : __builtin_cpu_supports("sse4.1") ? simd_level::sse41
+                            : simd_level::sse2;
+#elif defined(SG14_AVX2_ENABLED)
+                    return simd_level::avx2;
+#elif defined(SG14_SSE2_ENABLED)
+                    return simd_level::sse2;
+#else
+                    return simd_level::none;
+#endif
+                }
+
+                // the level named by name, e.g. the value of environment variable, SG14_SIMD_LEVEL,
+                // or otherwise if name is null or names no level
+                inline simd_level parse_simd_level(char const* name, simd_level otherwise)
+                {
+                    return (name==nullptr) ? otherwise
+                            : (std::strcmp(name, "none")==0) ? simd_level::none
+                            : (std::strcmp(name, "sse2")==0) ? simd_level::sse2
+                            : (std::strcmp(name, "sse4.1")==0) ? simd_level::sse41
+                            : (std::strcmp(name, "avx2")==0) ? simd_level::avx2
+                            : (std::strcmp(name, "avx512")==0) ? simd_level::avx512
+                            : otherwise;
+                }
+
+                constexpr simd_level lesser_level(simd_level a, simd_level b)
+                {
+                    return (a<b) ? a : b;
+                }
+
+                // the processor is probed once
+                inline simd_level detected_level()
+                {
+                    static auto const level = probe_simd_level();
+                    return level;
+                }
+
+                // the level of the kernels which are called
+                inline std::atomic<int>& selected_level()
+                {
+                    static std::atomic<int> level{static_cast<int>(lesser_level(
+                            parse_simd_level(std::getenv("SG14_SIMD_LEVEL"), detected_level()),
+                            detected_level()))};
+                    return level;
+                }
+
+#if defined(SG14_SSE2_ENABLED)
+                ////////////////////////////////////////////////////////////////////////////////
+                // dispatch
+
+                // calls the kernel of the selected level which applies operation to whole registers of elements
+                // and returns the number of elements which it calculated
+                template<class Rep, class Operation>
+                std::size_t dispatch(Rep const* lhs, Rep const* rhs, Rep* output, std::size_t size, Operation operation)
+                {
+                    using kernel = std::size_t(Rep const*, Rep const*, Rep*, std::size_t, Operation);
+                    static kernel* const kernels[] = {
+                            nullptr, sse2::transform_array<Rep, Operation>, sse41::transform_array<Rep, Operation>,
+                            avx2::transform_array<Rep, Operation>, avx512::transform_array<Rep, Operation>};
+                    auto selected = kernels[selected_level().load(std::memory_order_relaxed)];
+                    return (selected==nullptr) ? 0 : selected(lhs, rhs, output, size, operation);
+                }
+
+                template<class Rep, class Operation>
+                std::size_t dispatch(Rep const* input, Rep* output, std::size_t size, Operation operation)
+                {
+                    using kernel = std::size_t(Rep const*, Rep*, std::size_t, Operation);
+                    static kernel* const kernels[] = {
+                            nullptr, sse2::transform_array<Rep, Operation>, sse41::transform_array<Rep, Operation>,
+                            avx2::transform_array<Rep, Operation>, avx512::transform_array<Rep, Operation>};
+                    auto selected = kernels[selected_level().load(std::memory_order_relaxed)];
+                    return (selected==nullptr) ? 0 : selected(input, output, size, operation);
+                }
+#endif
+
+                ////////////////////////////////////////////////////////////////////////////////
+                // kernels
+                //
+                // each returns the number of leading elements which it calculated;
+                // types which are not supported are left for the scalar operators
+
+                template<class Lhs, class Rhs, class Output>
+                std::size_t add_vectors(Lhs const*, Rhs const*, Output*, std::size_t)
+                {
+                    return 0;
+                }
+
+                template<class Lhs, class Rhs, class Output>
+                std::size_t subtract_vectors(Lhs const*, Rhs const*, Output*, std::size_t)
+                {
+                    return 0;
+                }
+
+                template<class Lhs, class Rhs, class Output>
+                std::size_t multiply_vectors(Lhs const*, Rhs const*, Output*, std::size_t)
+                {
+                    return 0;
+                }
+
+                template<class Input, class Factor, class Output>
+                std::size_t scale_vectors(Input const*, Factor const&, Output*, std::size_t)
+                {
+                    return 0;
+                }
+
+#if defined(SG14_SSE2_ENABLED)
+                template<class Rep, int Exponent, enable_if_t<is_lane_rep<Rep>::value, int> Dummy = 0>
+                std::size_t add_vectors(
+                        fixed_point<Rep, Exponent> const* lhs, fixed_point<Rep, Exponent> const* rhs,
+                        fixed_point<Rep, Exponent>* output, std::size_t size)
+                {
+                    return dispatch(rep_data(lhs), rep_data(rhs), rep_data(output), size, add_operation<Rep>{});
+                }
+
+                template<class Rep, int Exponent, enable_if_t<is_lane_rep<Rep>::value, int> Dummy = 0>
+                std::size_t subtract_vectors(
+                        fixed_point<Rep, Exponent> const* lhs, fixed_point<Rep, Exponent> const* rhs,
+                        fixed_point<Rep, Exponent>* output, std::size_t size)
+                {
+                    return dispatch(rep_data(lhs), rep_data(rhs), rep_data(output), size, subtract_operation<Rep>{});
+                }
+
+                // the product, with exponent LhsExponent+RhsExponent, is shifted to OutputExponent
+                template<class Rep, int LhsExponent, int RhsExponent, int OutputExponent,
+                        enable_if_t<is_lane_rep<Rep>::value
+                                && is_lane_shift<Rep>(OutputExponent-LhsExponent-RhsExponent), int> Dummy = 0>
+                std::size_t multiply_vectors(
+                        fixed_point<Rep, LhsExponent> const* lhs, fixed_point<Rep, RhsExponent> const* rhs,
+                        fixed_point<Rep, OutputExponent>* output, std::size_t size)
+                {
+                    return dispatch(rep_data(lhs), rep_data(rhs), rep_data(output), size, multiply_operation<Rep>{
+                            make_product_shift(OutputExponent-LhsExponent-RhsExponent)});
+                }
+
+                template<class Rep, int InputExponent, int FactorExponent, int OutputExponent,
+                        enable_if_t<is_lane_rep<Rep>::value
+                                && is_lane_shift<Rep>(OutputExponent-InputExponent-FactorExponent), int> Dummy = 0>
+                std::size_t scale_vectors(
+                        fixed_point<Rep, InputExponent> const* input, fixed_point<Rep, FactorExponent> const& factor,
+                        fixed_point<Rep, OutputExponent>* output, std::size_t size)
+                {
+                    return dispatch(rep_data(input), rep_data(output), size, scale_operation<Rep>{
+                            factor.data(), make_product_shift(OutputExponent-InputExponent-FactorExponent)});
+                }
+
+                template<class Rep, int Exponent, enable_if_t<is_saturated_lane_rep<Rep>::value, int> Dummy = 0>
+                std::size_t add_vectors(
+                        fixed_point<saturated_integer<Rep>, Exponent> const* lhs,
+                        fixed_point<saturated_integer<Rep>, Exponent> const* rhs,
+                        fixed_point<saturated_integer<Rep>, Exponent>* output, std::size_t size)
+                {
+                    return dispatch(rep_data(lhs), rep_data(rhs), rep_data(output), size, saturated_add_operation<Rep>{});
+                }
+
+                template<class Rep, int Exponent, enable_if_t<is_saturated_lane_rep<Rep>::value, int> Dummy = 0>
+                std::size_t subtract_vectors(
+                        fixed_point<saturated_integer<Rep>, Exponent> const* lhs,
+                        fixed_point<saturated_integer<Rep>, Exponent> const* rhs,
+                        fixed_point<saturated_integer<Rep>, Exponent>* output, std::size_t size)
+                {
+                    return dispatch(rep_data(lhs), rep_data(rhs), rep_data(output), size, saturated_subtract_operation<Rep>{});
+                }
+
+                template<class Rep, int LhsExponent, int RhsExponent, int OutputExponent,
+                        enable_if_t<is_saturated_lane_rep<Rep>::value
+                                && is_saturated_lane_shift<Rep>(OutputExponent-LhsExponent-RhsExponent), int> Dummy = 0>
+                std::size_t multiply_vectors(
+                        fixed_point<saturated_integer<Rep>, LhsExponent> const* lhs,
+                        fixed_point<saturated_integer<Rep>, RhsExponent> const* rhs,
+                        fixed_point<saturated_integer<Rep>, OutputExponent>* output, std::size_t size)
+                {
+                    return dispatch(rep_data(lhs), rep_data(rhs), rep_data(output), size, saturated_multiply_operation<Rep>{
+                            make_product_shift(OutputExponent-LhsExponent-RhsExponent)});
+                }
+
+                template<class Rep, int InputExponent, int FactorExponent, int OutputExponent,
+                        enable_if_t<is_saturated_lane_rep<Rep>::value
+                                && is_saturated_lane_shift<Rep>(OutputExponent-InputExponent-FactorExponent), int> Dummy = 0>
+                std::size_t scale_vectors(
+                        fixed_point<saturated_integer<Rep>, InputExponent> const* input,
+                        fixed_point<saturated_integer<Rep>, FactorExponent> const& factor,
+                        fixed_point<saturated_integer<Rep>, OutputExponent>* output, std::size_t size)
+                {
+                    return dispatch(rep_data(input), rep_data(output), size, saturated_scale_operation<Rep>{
+                            static_cast<Rep>(factor.data()), make_product_shift(OutputExponent-InputExponent-FactorExponent)});
+                }
+#endif
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::detected_simd_level, sg14::get_simd_level, sg14::set_simd_level
+
+    /// \brief the highest \ref simd_level which the processor supports
+    /// \headerfile sg14/auxiliary/fixed_point_array.h
+    ///
+    /// Where the compiler is GCC or Clang and the target is x86, the processor is probed once
+    /// and the kernels of every level are compiled regardless of the instructions which the compiler targets.
+    /// Otherwise, this is the level which the compiler targets.
+    inline simd_level detected_simd_level()
+    {
+        return _impl::fp::simd::detected_level();
+    }
+
+    /// \brief the \ref simd_level with which the kernels of \ref transform_add and related functions are calculated
+    /// \headerfile sg14/auxiliary/fixed_point_array.h
+    ///
+    /// Initially, this is the level named by environment variable, `SG14_SIMD_LEVEL`
+    /// (one of `none`, `sse2`, `sse4.1`, `avx2` or `avx512`), if it is set, or \ref detected_simd_level otherwise.
+    ///
+    /// \sa set_simd_level
+    inline simd_level get_simd_level()
+    {
+        return static_cast<simd_level>(_impl::fp::simd::selected_level().load(std::memory_order_relaxed));
+    }
+
+    /// \brief forces the \ref simd_level with which the kernels of \ref transform_add and related functions are calculated
+    /// \headerfile sg14/auxiliary/fixed_point_array.h
+    ///
+    /// \param level the requested level
+    /// \return the selected level, which is the lesser of \a level and \ref detected_simd_level
+    ///
+    /// \note Results are identical at every level.
+    /// \sa get_simd_level
+    inline simd_level set_simd_level(simd_level level)
+    {
+        auto selected = _impl::fp::simd::lesser_level(level, detected_simd_level());
+        _impl::fp::simd::selected_level().store(static_cast<int>(selected), std::memory_order_relaxed);
+        return selected;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::transform_add, sg14::transform_subtract, sg14::transform_multiply, sg14::transform_scale
+
+    /// \brief calculates the sum of each of the \a size elements of \a lhs and the corresponding element of \a rhs
+    /// \headerfile sg14/auxiliary/fixed_point_array.h
+    ///
+    /// Each result is identical to `static_cast<fixed_point<OutputRep, OutputExponent>>(lhs[i]+rhs[i])`.
+    /// Where the inputs and output are of the same type and its rep is a built-in integer of up to 32 bits,
+    /// whole registers of elements are added with SIMD instructions of the level returned by \ref get_simd_level.
+    /// So are those whose rep is a \ref safe_integer of `saturated_overflow_tag` and a signed integer of up to 16 bits,
+    /// e.g. Q7 and Q15 values, with saturating instructions.
+    ///
+    /// \param lhs the first element of an array of augends
+    /// \param rhs the first element of an array of addends
+    /// \param output the first element of an array of \a size results; may be equal to \a lhs or \a rhs
+    /// \param size the number of elements
+    template<class LhsRep, int LhsExponent, class RhsRep, int RhsExponent, class OutputRep, int OutputExponent>
+    void transform_add(
+            fixed_point<LhsRep, LhsExponent> const* lhs, fixed_point<RhsRep, RhsExponent> const* rhs,
+            fixed_point<OutputRep, OutputExponent>* output, std::size_t size)
+    {
+        using output_type = fixed_point<OutputRep, OutputExponent>;
+        for (auto index = _impl::fp::simd::add_vectors(lhs, rhs, output, size); index<size; ++index) {
+            output[index] = static_cast<output_type>(lhs[index]+rhs[index]);
+        }
+    }
+
+    /// \brief calculates the difference between each of the \a size elements of \a lhs
+    /// and the corresponding element of \a rhs
+    /// \headerfile sg14/auxiliary/fixed_point_array.h
+    ///
+    /// Each result is identical to `static_cast<fixed_point<OutputRep, OutputExponent>>(lhs[i]-rhs[i])`.
+    ///
+    /// \param lhs the first element of an array of minuends
+    /// \param rhs the first element of an array of subtrahends
+    /// \param output the first element of an array of \a size results; may be equal to \a lhs or \a rhs
+    /// \param size the number of elements
+    ///
+    /// \sa transform_add
+    template<class LhsRep, int LhsExponent, class RhsRep, int RhsExponent, class OutputRep, int OutputExponent>
+    void transform_subtract(
+            fixed_point<LhsRep, LhsExponent> const* lhs, fixed_point<RhsRep, RhsExponent> const* rhs,
+            fixed_point<OutputRep, OutputExponent>* output, std::size_t size)
+    {
+        using output_type = fixed_point<OutputRep, OutputExponent>;
+        for (auto index = _impl::fp::simd::subtract_vectors(lhs, rhs, output, size); index<size; ++index) {
+            output[index] = static_cast<output_type>(lhs[index]-rhs[index]);
+        }
+    }
+
+    /// \brief calculates the product of each of the \a size elements of \a lhs and the corresponding element of \a rhs
+    /// \headerfile sg14/auxiliary/fixed_point_array.h
+    ///
+    /// Each result is identical to `static_cast<fixed_point<OutputRep, OutputExponent>>(lhs[i]*rhs[i])`,
+    /// i.e. digits which are lost are rounded toward zero.
+    /// Where the inputs and output have the same rep and it is a built-in integer of up to 32 bits,
+    /// whole registers of elements are multiplied with SIMD instructions of the level returned by \ref get_simd_level.
+    /// So are those whose rep is a \ref safe_integer of `saturated_overflow_tag` and a signed integer of up to 16 bits,
+    /// provided that no digits are gained, i.e. `OutputExponent>=LhsExponent+RhsExponent`.
+    ///
+    /// \param lhs the first element of an array of multiplicands
+    /// \param rhs the first element of an array of multipliers
+    /// \param output the first element of an array of \a size results; may be equal to \a lhs or \a rhs
+    /// \param size the number of elements
+    template<class LhsRep, int LhsExponent, class RhsRep, int RhsExponent, class OutputRep, int OutputExponent>
+    void transform_multiply(
+            fixed_point<LhsRep, LhsExponent> const* lhs, fixed_point<RhsRep, RhsExponent> const* rhs,
+            fixed_point<OutputRep, OutputExponent>* output, std::size_t size)
+    {
+        using output_type = fixed_point<OutputRep, OutputExponent>;
+        for (auto index = _impl::fp::simd::multiply_vectors(lhs, rhs, output, size); index<size; ++index) {
+            output[index] = static_cast<output_type>(lhs[index]*rhs[index]);
+        }
+    }
+
+    /// \brief calculates the product of each of the \a size elements of \a input and \a factor
+    /// \headerfile sg14/auxiliary/fixed_point_array.h
+    ///
+    /// Each result is identical to `static_cast<fixed_point<OutputRep, OutputExponent>>(input[i]*factor)`.
+    ///
+    /// \param input the first element of an array of multiplicands
+    /// \param factor the multiplier of every element
+    /// \param output the first element of an array of \a size results; may be equal to \a input
+    /// \param size the number of elements
+    ///
+    /// \sa transform_multiply
+    template<class InputRep, int InputExponent, class FactorRep, int FactorExponent, class OutputRep, int OutputExponent>
+    void transform_scale(
+            fixed_point<InputRep, InputExponent> const* input, fixed_point<FactorRep, FactorExponent> const& factor,
+            fixed_point<OutputRep, OutputExponent>* output, std::size_t size)
+    {
+        using output_type = fixed_point<OutputRep, OutputExponent>;
+        for (auto index = _impl::fp::simd::scale_vectors(input, factor, output, size); index<size; ++index) {
+            output[index] = static_cast<output_type>(input[index]*factor);
+        }
+    }
+}
+
+#undef SG14_SIMD_TARGET
+#undef SG14_SIMD_INLINE
+
+#endif	// SG14_FIXED_POINT_ARRAY_H
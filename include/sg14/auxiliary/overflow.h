@@ -37,6 +37,11 @@ namespace sg14 {
     static constexpr struct saturated_overflow_tag {
     } saturated_overflow{};
 
+    // match the behavior of fundamental arithmetic types
+    // and record overflow in a flag belonging to the calling thread (see clear_sticky_overflow)
+    static constexpr struct sticky_overflow_tag {
+    } sticky_overflow{};
+
     ////////////////////////////////////////////////////////////////////////////////
     // sg14::convert
 
@@ -125,6 +130,489 @@ namespace sg14 {
             return source<static_cast<Source>(std::numeric_limits<Destination>::lowest());
         }
 
+        ////////////////////////////////////////////////////////////////////////////////
+        // arithmetic overflow detection
+
+        // comparisons against the limits of the result which are valid in constant expressions
+        // and for any type with arithmetic operators
+        template<class Operator>
+        struct portable_overflow;
+
+        template<>
+        struct portable_overflow<_impl::add_op> {
+            template<class Lhs, class Rhs>
+            static constexpr bool is_overflow(const Lhs& lhs, const Rhs& rhs)
+            {
+                using numeric_limits = std::numeric_limits<decltype(lhs+rhs)>;
+                return (rhs>=_impl::from_rep<Rhs>(0))
+                       ? (lhs>numeric_limits::max()-rhs)
+                       : (lhs<numeric_limits::lowest()-rhs);
+            }
+
+            template<class Lhs, class Rhs>
+            static constexpr auto saturate(const Lhs& lhs, const Rhs& rhs)
+            -> decltype(lhs+rhs)
+            {
+                using numeric_limits = std::numeric_limits<decltype(lhs+rhs)>;
+                return is_overflow(lhs, rhs)
+                       ? (rhs>0) ? numeric_limits::max() : numeric_limits::lowest()
+                       : lhs+rhs;
+            }
+        };
+
+        template<>
+        struct portable_overflow<_impl::subtract_op> {
+            template<class Lhs, class Rhs>
+            static constexpr bool is_overflow(const Lhs& lhs, const Rhs& rhs)
+            {
+                using numeric_limits = std::numeric_limits<decltype(lhs-rhs)>;
+                return (rhs<_impl::from_rep<Rhs>(0))
+                       ? (lhs>numeric_limits::max()+rhs)
+                       : (lhs<numeric_limits::lowest()+rhs);
+            }
+
+            template<class Lhs, class Rhs>
+            static constexpr auto saturate(const Lhs& lhs, const Rhs& rhs)
+            -> decltype(lhs-rhs)
+            {
+                using numeric_limits = std::numeric_limits<decltype(lhs-rhs)>;
+                return is_overflow(lhs, rhs)
+                       ? (rhs<0) ? numeric_limits::max() : numeric_limits::lowest()
+                       : lhs-rhs;
+            }
+        };
+
+        // lowest() is only divided by a positive operand because lowest()/-1 traps
+        template<class Lhs, class Rhs>
+        constexpr bool is_multiply_overflow(const Lhs& lhs, const Rhs& rhs)
+        {
+            using result_nl = std::numeric_limits<decltype(lhs*rhs)>;
+            return lhs && rhs && ((lhs>Lhs{})
+                                  ? ((rhs>Rhs{}) ? (result_nl::max()/rhs)<lhs : (result_nl::lowest()/lhs)>rhs)
+                                  : ((rhs>Rhs{}) ? (result_nl::lowest()/rhs)>lhs : (result_nl::max()/rhs)>lhs));
+        }
+
+        template<>
+        struct portable_overflow<_impl::multiply_op> {
+            template<class Lhs, class Rhs>
+            static constexpr bool is_overflow(const Lhs& lhs, const Rhs& rhs)
+            {
+                return is_multiply_overflow(lhs, rhs);
+            }
+
+            template<class Lhs, class Rhs>
+            static constexpr auto saturate(const Lhs& lhs, const Rhs& rhs)
+            -> decltype(lhs*rhs)
+            {
+                using numeric_limits = std::numeric_limits<decltype(lhs*rhs)>;
+                return is_overflow(lhs, rhs)
+                       ? ((lhs>0) ^ (rhs>0)) ? numeric_limits::lowest() : numeric_limits::max()
+                       : lhs*rhs;
+            }
+        };
+
+        // value converted to Destination or, if it cannot be represented, the nearest limit of Destination
+        template<class Destination, class Source>
+        constexpr Destination portable_convert_saturated(const Source& source)
+        {
+            using numeric_limits = std::numeric_limits<Destination>;
+            return !_impl::encompasses<Destination, Source>::value
+                   ? is_positive_overflow<Destination>(source)
+                     ? numeric_limits::max()
+                     : is_negative_overflow<Destination>(source)
+                       ? numeric_limits::lowest()
+                       : static_cast<Destination>(source)
+                   : static_cast<Destination>(source);
+        }
+
+        // true iff T is a built-in integer which the overflow builtins accept
+        template<class T>
+        struct is_builtin_integer : std::integral_constant<bool,
+                std::is_integral<T>::value && !std::is_same<T, bool>::value> {
+        };
+
+        // true iff Operand is a built-in integer which converts to Result without change of value,
+        // so that the builtins, which test the mathematical result, agree with the comparisons above
+        template<class Operand, class Result>
+        struct is_builtin_overflow_operand : std::integral_constant<bool,
+                is_builtin_integer<Operand>::value
+                && !(std::is_signed<Operand>::value && !std::is_signed<Result>::value)> {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // branchless saturation of built-in integers
+
+        // true iff value is below zero; unlike `value<0`, draws no warning for unsigned types
+        template<class Integer, _impl::enable_if_t<std::is_signed<Integer>::value, int> dummy = 0>
+        constexpr bool is_negative(const Integer& value)
+        {
+            return value<Integer{0};
+        }
+
+        template<class Integer, _impl::enable_if_t<!std::is_signed<Integer>::value, int> dummy = 0>
+        constexpr bool is_negative(const Integer&)
+        {
+            return false;
+        }
+
+        // most significant bit of an unsigned value
+        template<class Unsigned>
+        constexpr bool top_bit(Unsigned value)
+        {
+            return (value >> (std::numeric_limits<Unsigned>::digits-1))!=Unsigned{0};
+        }
+
+        // lowest if negative, otherwise max;
+        // the two differ in every bit of a signed type or of an unsigned type, so one is the other masked
+        template<class Result>
+        constexpr Result saturation_limit(bool negative)
+        {
+            using unsigned_result = make_unsigned_t<Result>;
+            return static_cast<Result>(static_cast<unsigned_result>(
+                    static_cast<unsigned_result>(std::numeric_limits<Result>::max())
+                    ^ static_cast<unsigned_result>(unsigned_result{0}-unsigned_result{negative})));
+        }
+
+        // limit if overflow, otherwise result;
+        // formed by masking so that compilers do not reintroduce a branch on the overflow flag
+        template<class Result>
+        constexpr Result saturation_select(bool overflow, Result result, Result limit)
+        {
+            using unsigned_result = make_unsigned_t<Result>;
+            return static_cast<Result>(static_cast<unsigned_result>(
+                    static_cast<unsigned_result>(result)
+                    ^ (static_cast<unsigned_result>(static_cast<unsigned_result>(result) ^ static_cast<unsigned_result>(limit))
+                       & static_cast<unsigned_result>(unsigned_result{0}-unsigned_result{overflow}))));
+        }
+
+        // given the wrapped sum, true iff lhs+rhs cannot be represented;
+        // a signed sum overflows iff it differs in sign from both operands
+        template<class Result, _impl::enable_if_t<std::is_signed<Result>::value, int> dummy = 0>
+        constexpr bool is_sum_overflow(Result lhs, Result rhs, make_unsigned_t<Result> sum)
+        {
+            return top_bit(static_cast<make_unsigned_t<Result>>(
+                    (static_cast<make_unsigned_t<Result>>(lhs) ^ sum) & (static_cast<make_unsigned_t<Result>>(rhs) ^ sum)));
+        }
+
+        template<class Result, _impl::enable_if_t<!std::is_signed<Result>::value, int> dummy = 0>
+        constexpr bool is_sum_overflow(Result lhs, Result, Result sum)
+        {
+            return sum<lhs;
+        }
+
+        // given the wrapped difference, true iff lhs-rhs cannot be represented;
+        // a signed difference overflows iff the operands differ in sign and the result differs from lhs
+        template<class Result, _impl::enable_if_t<std::is_signed<Result>::value, int> dummy = 0>
+        constexpr bool is_difference_overflow(Result lhs, Result rhs, make_unsigned_t<Result> difference)
+        {
+            return top_bit(static_cast<make_unsigned_t<Result>>(
+                    (static_cast<make_unsigned_t<Result>>(lhs) ^ static_cast<make_unsigned_t<Result>>(rhs))
+                    & (static_cast<make_unsigned_t<Result>>(lhs) ^ difference)));
+        }
+
+        template<class Result, _impl::enable_if_t<!std::is_signed<Result>::value, int> dummy = 0>
+        constexpr bool is_difference_overflow(Result lhs, Result rhs, Result)
+        {
+            return lhs<rhs;
+        }
+
+        template<class Result>
+        constexpr Result saturated_sum(Result lhs, Result rhs, make_unsigned_t<Result> sum)
+        {
+            return saturation_select(
+                    is_sum_overflow(lhs, rhs, sum),
+                    static_cast<Result>(sum),
+                    saturation_limit<Result>(is_negative(lhs)));
+        }
+
+        // an unsigned difference can only overflow below zero
+        template<class Result>
+        constexpr Result saturated_difference(Result lhs, Result rhs, make_unsigned_t<Result> difference)
+        {
+            return saturation_select(
+                    is_difference_overflow(lhs, rhs, difference),
+                    static_cast<Result>(difference),
+                    saturation_limit<Result>(!std::is_signed<Result>::value || is_negative(lhs)));
+        }
+
+        // given the exact product in a wider type
+        template<class Result, class Wide>
+        constexpr Result saturated_product(Result lhs, Result rhs, Wide product)
+        {
+            return saturation_select(
+                    product!=static_cast<Wide>(static_cast<Result>(product)),
+                    static_cast<Result>(product),
+                    saturation_limit<Result>(is_negative(lhs)!=is_negative(rhs)));
+        }
+
+        // true iff source cannot be represented by Destination
+        template<class Destination, class Source,
+                _impl::enable_if_t<std::is_signed<Destination>::value==std::is_signed<Source>::value, int> dummy = 0>
+        constexpr bool is_convert_overflow(Source source)
+        {
+            return static_cast<Source>(static_cast<Destination>(source))!=source;
+        }
+
+        // conversion between signed and unsigned can preserve every bit and still change sign
+        template<class Destination, class Source,
+                _impl::enable_if_t<std::is_signed<Destination>::value!=std::is_signed<Source>::value, int> dummy = 0>
+        constexpr bool is_convert_overflow(Source source)
+        {
+            return (static_cast<Source>(static_cast<Destination>(source))!=source)
+                   | (is_negative(source)!=is_negative(static_cast<Destination>(source)));
+        }
+
+        template<class Destination, class Source>
+        constexpr Destination saturated_convert(Source source)
+        {
+            return _impl::encompasses<Destination, Source>::value
+                   ? static_cast<Destination>(source)
+                   : saturation_select(
+                           is_convert_overflow<Destination>(source),
+                           static_cast<Destination>(source),
+                           saturation_limit<Destination>(is_negative(source)));
+        }
+
+        // true iff a product of Result operands is exact in a built-in type
+        template<class Result>
+        struct has_wide_product : std::integral_constant<bool,
+                (std::numeric_limits<Result>::digits+std::numeric_limits<Result>::is_signed<=32)> {
+        };
+
+        template<class Result>
+        using wide_product = typename std::conditional<std::is_signed<Result>::value, std::int64_t, std::uint64_t>::type;
+
+#if defined(SG14_OVERFLOW_BUILTINS_ENABLED)
+        // the compiler's checked arithmetic which tests the flags set by the operation itself;
+        // not valid in constant expressions
+        template<class Operator>
+        struct builtin_overflow;
+
+        template<>
+        struct builtin_overflow<_impl::add_op> {
+            // stores the wrapped result
+            template<class Result, class Lhs, class Rhs>
+            static bool operate(const Lhs& lhs, const Rhs& rhs, Result& result)
+            {
+                return __builtin_add_overflow(lhs, rhs, &result);
+            }
+        };
+
+        template<>
+        struct builtin_overflow<_impl::subtract_op> {
+            template<class Result, class Lhs, class Rhs>
+            static bool operate(const Lhs& lhs, const Rhs& rhs, Result& result)
+            {
+                return __builtin_sub_overflow(lhs, rhs, &result);
+            }
+        };
+
+        template<>
+        struct builtin_overflow<_impl::multiply_op> {
+            template<class Result, class Lhs, class Rhs>
+            static bool operate(const Lhs& lhs, const Rhs& rhs, Result& result)
+            {
+                return __builtin_mul_overflow(lhs, rhs, &result);
+            }
+
+            // products too wide to be calculated exactly in a built-in type
+            template<class Result>
+            static Result saturate(Result lhs, Result rhs)
+            {
+                Result result;
+                auto overflow = __builtin_mul_overflow(lhs, rhs, &result);
+                return saturation_select(overflow, result,
+                        saturation_limit<Result>(is_negative(lhs)!=is_negative(rhs)));
+            }
+        };
+
+        template<class Operator, class Lhs, class Rhs>
+        bool builtin_is_overflow(const Lhs& lhs, const Rhs& rhs)
+        {
+            _impl::op_result<Operator, Lhs, Rhs> result;
+            return builtin_overflow<Operator>::operate(lhs, rhs, result);
+        }
+
+        template<class Operator, class Lhs, class Rhs>
+        struct has_overflow_builtins : std::integral_constant<bool,
+                is_builtin_overflow_operand<Lhs, _impl::op_result<Operator, Lhs, Rhs>>::value
+                && is_builtin_overflow_operand<Rhs, _impl::op_result<Operator, Lhs, Rhs>>::value> {
+        };
+#else
+        template<class Operator, class Lhs, class Rhs>
+        struct has_overflow_builtins : std::false_type {
+        };
+#endif
+
+        // true iff the result of Operator()(lhs, rhs) cannot be represented by its type
+        template<class Operator, class Lhs, class Rhs,
+                _impl::enable_if_t<!has_overflow_builtins<Operator, Lhs, Rhs>::value, int> dummy = 0>
+        constexpr bool is_overflow(const Lhs& lhs, const Rhs& rhs)
+        {
+            return portable_overflow<Operator>::is_overflow(lhs, rhs);
+        }
+
+#if defined(SG14_OVERFLOW_BUILTINS_ENABLED)
+        // constant evaluation cannot call the builtins, so constant operands take the portable path
+        template<class Operator, class Lhs, class Rhs,
+                _impl::enable_if_t<has_overflow_builtins<Operator, Lhs, Rhs>::value, int> dummy = 0>
+        constexpr bool is_overflow(const Lhs& lhs, const Rhs& rhs)
+        {
+            return (__builtin_constant_p(lhs) && __builtin_constant_p(rhs))
+                   ? portable_overflow<Operator>::is_overflow(lhs, rhs)
+                   : builtin_is_overflow<Operator>(lhs, rhs);
+        }
+#endif
+
+        // saturating arithmetic which computes the wrapped result and selects between it and a limit;
+        // branches on overflow mispredict when data is noisy and near the limits
+        template<class Operator>
+        struct branchless_overflow;
+
+        template<>
+        struct branchless_overflow<_impl::add_op> {
+            template<class Result>
+            static constexpr Result saturate(Result lhs, Result rhs)
+            {
+                return saturated_sum(lhs, rhs, static_cast<make_unsigned_t<Result>>(
+                        static_cast<make_unsigned_t<Result>>(lhs)+static_cast<make_unsigned_t<Result>>(rhs)));
+            }
+        };
+
+        template<>
+        struct branchless_overflow<_impl::subtract_op> {
+            template<class Result>
+            static constexpr Result saturate(Result lhs, Result rhs)
+            {
+                return saturated_difference(lhs, rhs, static_cast<make_unsigned_t<Result>>(
+                        static_cast<make_unsigned_t<Result>>(lhs)-static_cast<make_unsigned_t<Result>>(rhs)));
+            }
+        };
+
+        template<>
+        struct branchless_overflow<_impl::multiply_op> {
+            template<class Result, _impl::enable_if_t<has_wide_product<Result>::value, int> dummy = 0>
+            static constexpr Result saturate(Result lhs, Result rhs)
+            {
+                return saturated_product(lhs, rhs,
+                        static_cast<wide_product<Result>>(lhs)*static_cast<wide_product<Result>>(rhs));
+            }
+
+#if defined(SG14_OVERFLOW_BUILTINS_ENABLED)
+            template<class Result, _impl::enable_if_t<!has_wide_product<Result>::value, int> dummy = 0>
+            static constexpr Result saturate(Result lhs, Result rhs)
+            {
+                return (__builtin_constant_p(lhs) && __builtin_constant_p(rhs))
+                       ? portable_overflow<_impl::multiply_op>::saturate(lhs, rhs)
+                       : builtin_overflow<_impl::multiply_op>::saturate(lhs, rhs);
+            }
+#endif
+        };
+
+        // true iff both operands convert to the result without change of value
+        // and saturation is available without branches
+        template<class Operator, class Lhs, class Rhs>
+        struct has_branchless_saturation : std::integral_constant<bool,
+                is_builtin_overflow_operand<Lhs, _impl::op_result<Operator, Lhs, Rhs>>::value
+                && is_builtin_overflow_operand<Rhs, _impl::op_result<Operator, Lhs, Rhs>>::value> {
+        };
+
+#if !defined(SG14_OVERFLOW_BUILTINS_ENABLED)
+        template<class Lhs, class Rhs>
+        struct has_branchless_saturation<_impl::multiply_op, Lhs, Rhs> : std::integral_constant<bool,
+                is_builtin_overflow_operand<Lhs, _impl::op_result<_impl::multiply_op, Lhs, Rhs>>::value
+                && is_builtin_overflow_operand<Rhs, _impl::op_result<_impl::multiply_op, Lhs, Rhs>>::value
+                && has_wide_product<_impl::op_result<_impl::multiply_op, Lhs, Rhs>>::value> {
+        };
+#endif
+
+        // result of Operator()(lhs, rhs) or, if it cannot be represented, the limit toward which it overflows
+        template<class Operator, class Lhs, class Rhs,
+                _impl::enable_if_t<!has_branchless_saturation<Operator, Lhs, Rhs>::value, int> dummy = 0>
+        constexpr auto saturate(const Lhs& lhs, const Rhs& rhs)
+        -> _impl::op_result<Operator, Lhs, Rhs>
+        {
+            return portable_overflow<Operator>::saturate(lhs, rhs);
+        }
+
+        template<class Operator, class Lhs, class Rhs,
+                _impl::enable_if_t<has_branchless_saturation<Operator, Lhs, Rhs>::value, int> dummy = 0>
+        constexpr auto saturate(const Lhs& lhs, const Rhs& rhs)
+        -> _impl::op_result<Operator, Lhs, Rhs>
+        {
+            using result_type = _impl::op_result<Operator, Lhs, Rhs>;
+            return branchless_overflow<Operator>::saturate(static_cast<result_type>(lhs), static_cast<result_type>(rhs));
+        }
+
+        template<class Destination, class Source,
+                _impl::enable_if_t<!(is_builtin_integer<Destination>::value && is_builtin_integer<Source>::value), int> dummy = 0>
+        constexpr Destination convert_saturated(const Source& source)
+        {
+            return portable_convert_saturated<Destination>(source);
+        }
+
+        template<class Destination, class Source,
+                _impl::enable_if_t<is_builtin_integer<Destination>::value && is_builtin_integer<Source>::value, int> dummy = 0>
+        constexpr Destination convert_saturated(const Source& source)
+        {
+            return saturated_convert<Destination>(source);
+        }
+
+        // true iff source cannot be represented by Destination
+        template<class Destination, class Source,
+                _impl::enable_if_t<!(is_builtin_integer<Destination>::value && is_builtin_integer<Source>::value), int> dummy = 0>
+        constexpr bool is_conversion_overflow(const Source& source)
+        {
+            return is_positive_overflow<Destination>(source) | is_negative_overflow<Destination>(source);
+        }
+
+        template<class Destination, class Source,
+                _impl::enable_if_t<is_builtin_integer<Destination>::value && is_builtin_integer<Source>::value, int> dummy = 0>
+        constexpr bool is_conversion_overflow(const Source& source)
+        {
+            return !_impl::encompasses<Destination, Source>::value && is_convert_overflow<Destination>(source);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // sticky overflow flag
+
+        // set by operations tagged with sticky_overflow_tag whose results overflow;
+        // it is only ever ORed so that recording costs no branch
+        inline bool& sticky_overflow_state()
+        {
+            static thread_local bool state = false;
+            return state;
+        }
+
+        template<class Result>
+        Result record_overflow(bool overflow, const Result& result)
+        {
+            sticky_overflow_state() |= overflow;
+            return result;
+        }
+
+        // result of Operator()(lhs, rhs), recording whether it overflows
+        template<class Operator, class Lhs, class Rhs,
+                _impl::enable_if_t<!has_overflow_builtins<Operator, Lhs, Rhs>::value, int> dummy = 0>
+        auto sticky_operate(const Lhs& lhs, const Rhs& rhs)
+        -> _impl::op_result<Operator, Lhs, Rhs>
+        {
+            return record_overflow(is_overflow<Operator>(lhs, rhs), Operator()(lhs, rhs));
+        }
+
+#if defined(SG14_OVERFLOW_BUILTINS_ENABLED)
+        // the builtins also give the wrapped result of signed operations which would otherwise be undefined
+        template<class Operator, class Lhs, class Rhs,
+                _impl::enable_if_t<has_overflow_builtins<Operator, Lhs, Rhs>::value, int> dummy = 0>
+        auto sticky_operate(const Lhs& lhs, const Rhs& rhs)
+        -> _impl::op_result<Operator, Lhs, Rhs>
+        {
+            _impl::op_result<Operator, Lhs, Rhs> result;
+            sticky_overflow_state() |= builtin_overflow<Operator>::operate(lhs, rhs, result);
+            return result;
+        }
+#endif
+
         ////////////////////////////////////////////////////////////////////////////////
         // operate
 
@@ -155,14 +643,15 @@ namespace sg14 {
     template<class Result, class Input>
     constexpr Result convert(saturated_overflow_tag, const Input& rhs)
     {
-        using numeric_limits = std::numeric_limits<Result>;
-        return !_impl::encompasses<Result, Input>::value
-               ? _overflow_impl::is_positive_overflow<Result>(rhs)
-                 ? numeric_limits::max()
-                 : _overflow_impl::is_negative_overflow<Result>(rhs)
-                   ? numeric_limits::lowest()
-                   : static_cast<Result>(rhs)
-               : static_cast<Result>(rhs);
+        return _overflow_impl::convert_saturated<Result>(rhs);
+    }
+
+    template<class Result, class Input>
+    Result convert(sticky_overflow_tag, const Input& rhs)
+    {
+        return _overflow_impl::record_overflow(
+                _overflow_impl::is_conversion_overflow<Result>(rhs),
+                static_cast<Result>(rhs));
     }
 
     ////////////////////////////////////////////////////////////////////////////////
@@ -186,12 +675,8 @@ namespace sg14 {
             constexpr auto operator()(const Lhs& lhs, const Rhs& rhs) const
             -> decltype(lhs+rhs)
             {
-                using result_type = decltype(lhs+rhs);
-                using numeric_limits = std::numeric_limits<result_type>;
                 return _overflow_impl::return_if(
-                        !((rhs>=_impl::from_rep<Rhs>(0))
-                          ? (lhs>numeric_limits::max()-rhs)
-                          : (lhs<numeric_limits::lowest()-rhs)),
+                        !is_overflow<_impl::add_op>(lhs, rhs),
                         lhs+rhs,
                         "overflow in addition");
             }
@@ -203,11 +688,17 @@ namespace sg14 {
             constexpr auto operator()(const Lhs& lhs, const Rhs& rhs) const
             -> _impl::op_result<_impl::add_op, Lhs, Rhs>
             {
-                using result_type = decltype(lhs+rhs);
-                using numeric_limits = std::numeric_limits<result_type>;
-                return (rhs>0)
-                       ? (lhs>numeric_limits::max()-rhs) ? numeric_limits::max() : lhs+rhs
-                       : (lhs<numeric_limits::lowest()-rhs) ? numeric_limits::lowest() : lhs+rhs;
+                return saturate<_impl::add_op>(lhs, rhs);
+            }
+        };
+
+        template<>
+        struct operate<sticky_overflow_tag, _impl::add_op> {
+            template<class Lhs, class Rhs>
+            auto operator()(const Lhs& lhs, const Rhs& rhs) const
+            -> decltype(lhs+rhs)
+            {
+                return sticky_operate<_impl::add_op>(lhs, rhs);
             }
         };
     }
@@ -240,12 +731,8 @@ namespace sg14 {
             constexpr auto operator()(const Lhs& lhs, const Rhs& rhs) const
             -> decltype(lhs-rhs)
             {
-                using result_type = decltype(lhs-rhs);
-                using numeric_limits = std::numeric_limits<result_type>;
                 return _overflow_impl::return_if(
-                        (rhs<_impl::from_rep<Rhs>(0))
-                        ? (lhs<=numeric_limits::max()+rhs)
-                        : (lhs>=numeric_limits::lowest()+rhs),
+                        !is_overflow<_impl::subtract_op>(lhs, rhs),
                         lhs-rhs,
                         "positive overflow in subtraction");
             }
@@ -257,11 +744,17 @@ namespace sg14 {
             constexpr auto operator()(const Lhs& lhs, const Rhs& rhs) const
             -> _impl::op_result<_impl::subtract_op, Lhs, Rhs>
             {
-                using result_type = decltype(lhs-rhs);
-                using numeric_limits = std::numeric_limits<result_type>;
-                return (rhs<0)
-                       ? (lhs>numeric_limits::max()+rhs) ? numeric_limits::max() : lhs-rhs
-                       : (lhs<numeric_limits::lowest()+rhs) ? numeric_limits::lowest() : lhs-rhs;
+                return saturate<_impl::subtract_op>(lhs, rhs);
+            }
+        };
+
+        template<>
+        struct operate<sticky_overflow_tag, _impl::subtract_op> {
+            template<class Lhs, class Rhs>
+            auto operator()(const Lhs& lhs, const Rhs& rhs) const
+            -> decltype(lhs-rhs)
+            {
+                return sticky_operate<_impl::subtract_op>(lhs, rhs);
             }
         };
     }
@@ -288,15 +781,6 @@ namespace sg14 {
             }
         };
 
-        template<class Lhs, class Rhs>
-        constexpr bool is_multiply_overflow(const Lhs& lhs, const Rhs& rhs)
-        {
-            using result_nl = std::numeric_limits<decltype(lhs*rhs)>;
-            return lhs && rhs && ((lhs>Lhs{})
-                                  ? ((rhs>Rhs{}) ? (result_nl::max()/rhs) : (result_nl::lowest()/rhs))<lhs
-                                  : ((rhs>Rhs{}) ? (result_nl::lowest()/rhs) : (result_nl::max()/rhs))>lhs);
-        }
-
         template<>
         struct operate<throwing_overflow_tag, _impl::multiply_op> {
             template<class Lhs, class Rhs>
@@ -304,7 +788,7 @@ namespace sg14 {
             -> decltype(lhs*rhs)
             {
                 return _overflow_impl::return_if(
-                        !is_multiply_overflow(lhs, rhs),
+                        !is_overflow<_impl::multiply_op>(lhs, rhs),
                         lhs*rhs, "overflow in multiplication");
             }
         };
@@ -315,12 +799,17 @@ namespace sg14 {
             constexpr auto operator()(const Lhs& lhs, const Rhs& rhs) const
             -> _impl::op_result<_impl::multiply_op, Lhs, Rhs>
             {
-                using result_type = decltype(lhs*rhs);
-                return is_multiply_overflow(lhs, rhs)
-                       ? ((lhs>0) ^ (rhs>0))
-                         ? std::numeric_limits<result_type>::lowest()
-                         : std::numeric_limits<result_type>::max()
-                       : lhs*rhs;
+                return saturate<_impl::multiply_op>(lhs, rhs);
+            }
+        };
+
+        template<>
+        struct operate<sticky_overflow_tag, _impl::multiply_op> {
+            template<class Lhs, class Rhs>
+            auto operator()(const Lhs& lhs, const Rhs& rhs) const
+            -> decltype(lhs*rhs)
+            {
+                return sticky_operate<_impl::multiply_op>(lhs, rhs);
             }
         };
     }
@@ -364,6 +853,12 @@ namespace sg14 {
         }
         };
 
+        template<class Operator>
+        struct operate<sticky_overflow_tag, Operator,
+                _impl::enable_if_t<Operator::is_comparison>>
+                : operate<native_overflow_tag, Operator> {
+        };
+
         template<class Operator>
         struct operate<throwing_overflow_tag, Operator,
                 _impl::enable_if_t<Operator::is_comparison>> {
@@ -391,6 +886,25 @@ namespace sg14 {
             }
         };
     }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::sticky_overflow_occurred, sg14::clear_sticky_overflow
+
+    // true iff an operation tagged with sticky_overflow_tag has overflowed on the calling thread
+    // since the flag was last cleared
+    inline bool sticky_overflow_occurred()
+    {
+        return _overflow_impl::sticky_overflow_state();
+    }
+
+    // clears the calling thread's sticky overflow flag and returns its previous value;
+    // intended to be called once per block of work
+    inline bool clear_sticky_overflow()
+    {
+        auto occurred = _overflow_impl::sticky_overflow_state();
+        _overflow_impl::sticky_overflow_state() = false;
+        return occurred;
+    }
 }
 
 #endif //SG14_OVERFLOW_H
@@ -0,0 +1,135 @@
+
+//          Copyright John McFarlane 2015 - 2016.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief an overflow tag which counts the overflows of each call site
+
+#if !defined(SG14_OVERFLOW_COUNTING_H)
+#define SG14_OVERFLOW_COUNTING_H 1
+
+#include "overflow.h"
+#include <sg14/bits/thread_records.h>
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+/// study group 14 of the C++ working group
+namespace sg14 {
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::counting_overflow_tag
+
+    // behave as OverflowTag and count the results which overflow;
+    // Key is a user-defined type identifying the call site
+    // which has a static member function, name(), returning a null-terminated string
+    template<class Key, class OverflowTag = saturated_overflow_tag>
+    struct counting_overflow_tag {
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::overflow_count
+
+    // total number of overflows counted for the key with the given name
+    struct overflow_count {
+        char const* name;
+        std::uint64_t count;
+    };
+
+    // implementation details
+    namespace _overflow_impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // counters
+
+        // the count of one key by one thread; written only by that thread
+        struct overflow_counter {
+            std::atomic<std::uint64_t> count;
+            overflow_counter* next;
+        };
+
+        template<class Key>
+        void count_overflow(bool overflow)
+        {
+            auto& counter = _impl::thread_record<overflow_counter, Key>().count;
+            _impl::store_thread_record(counter, counter.load(std::memory_order_relaxed)+overflow);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // operate
+
+        template<class Key, class OverflowTag, class Operator>
+        struct counting_operate {
+            template<class Lhs, class Rhs>
+            auto operator()(const Lhs& lhs, const Rhs& rhs) const
+            -> decltype(operate<OverflowTag, Operator>()(lhs, rhs))
+            {
+                count_overflow<Key>(is_overflow<Operator>(lhs, rhs));
+                return operate<OverflowTag, Operator>()(lhs, rhs);
+            }
+        };
+
+        template<class Key, class OverflowTag>
+        struct operate<counting_overflow_tag<Key, OverflowTag>, _impl::add_op>
+                : counting_operate<Key, OverflowTag, _impl::add_op> {
+        };
+
+        template<class Key, class OverflowTag>
+        struct operate<counting_overflow_tag<Key, OverflowTag>, _impl::subtract_op>
+                : counting_operate<Key, OverflowTag, _impl::subtract_op> {
+        };
+
+        template<class Key, class OverflowTag>
+        struct operate<counting_overflow_tag<Key, OverflowTag>, _impl::multiply_op>
+                : counting_operate<Key, OverflowTag, _impl::multiply_op> {
+        };
+
+        template<class Key, class OverflowTag, class Operator>
+        struct operate<counting_overflow_tag<Key, OverflowTag>, Operator,
+                _impl::enable_if_t<Operator::is_comparison>>
+                : operate<OverflowTag, Operator> {
+        };
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::convert
+
+    template<class Result, class Key, class OverflowTag, class Input>
+    Result convert(counting_overflow_tag<Key, OverflowTag>, const Input& rhs)
+    {
+        _overflow_impl::count_overflow<Key>(_overflow_impl::is_conversion_overflow<Result>(rhs));
+        return convert<Result>(OverflowTag{}, rhs);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::overflow_counts, sg14::dump_overflow_counts
+
+    // the number of overflows of each key which has been used, summed over all threads;
+    // counts which are being incremented concurrently may be slightly out of date
+    inline std::vector<overflow_count> overflow_counts()
+    {
+        std::vector<overflow_count> counts;
+        for (auto list = _impl::thread_record_lists<_overflow_impl::overflow_counter>().load(std::memory_order_acquire);
+             list;
+             list = list->next) {
+            auto total = std::uint64_t{0};
+            for (auto counter = list->records.load(std::memory_order_acquire); counter; counter = counter->next) {
+                total += counter->count.load(std::memory_order_relaxed);
+            }
+            counts.push_back(overflow_count{list->name, total});
+        }
+        return counts;
+    }
+
+    // writes one line per key, "name: count", to stream
+    inline void dump_overflow_counts(std::FILE* stream = stderr)
+    {
+        for (auto const& count : overflow_counts()) {
+            std::fprintf(stream, "%s: %llu\n", count.name, static_cast<unsigned long long>(count.count));
+        }
+    }
+}
+
+#endif	// SG14_OVERFLOW_COUNTING_H
@@ -11,12 +11,120 @@
 #include <sg14/bits/limits.h>
 
 namespace sg14 {
+    namespace _precise_integer_impl {
+        // quotient and remainder of n / d rounded toward zero,
+        // for reps whose arithmetic operators may return a different type or which lack operator%
+        template<class Rep>
+        constexpr Rep quotient(const Rep& n, const Rep& d)
+        {
+            return static_cast<Rep>(n/d);
+        }
 
+        template<class Rep>
+        constexpr Rep remainder(const Rep& n, const Rep& d)
+        {
+            return static_cast<Rep>(n-quotient(n, d)*d);
+        }
+
+        // q + delta in type, Rep
+        template<class Rep>
+        constexpr Rep adjust(const Rep& q, int delta)
+        {
+            return static_cast<Rep>(q+Rep{delta});
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // rounding policies
+    //
+    // convert rounds a floating-point value to an integer of type To;
+    // divide rounds the quotient of integers, n / d, where d is positive
+    // and is calculated in the rep without any floating-point intermediate
+
+    // round to nearest; halfway cases are rounded away from zero
     struct closest_rounding_policy {
         template<class To, class From>
         static constexpr To convert(const From& from)
         {
-            return static_cast<To>(std::intmax_t(from+((from>=0) ? .5 : -.5)));
+            return static_cast<To>(from+((from>=0) ? .5 : -.5));
+        }
+
+        // compares the remainder with d less the remainder so as not to overflow
+        template<class Rep>
+        static constexpr Rep divide(const Rep& n, const Rep& d)
+        {
+            using namespace _precise_integer_impl;
+            return (n>=Rep{0})
+                   ? adjust(quotient(n, d), remainder(n, d)>=d-remainder(n, d))
+                   : adjust(quotient(n, d), -int(-remainder(n, d)>=d+remainder(n, d)));
+        }
+    };
+
+    // round toward negative infinity
+    struct floor_rounding_policy {
+        template<class To, class From>
+        static constexpr To convert(const From& from)
+        {
+            return (static_cast<From>(static_cast<To>(from))>from) ? static_cast<To>(from)-To{1} : static_cast<To>(from);
+        }
+
+        template<class Rep>
+        static constexpr Rep divide(const Rep& n, const Rep& d)
+        {
+            using namespace _precise_integer_impl;
+            return adjust(quotient(n, d), -int(remainder(n, d)<Rep{0}));
+        }
+    };
+
+    // round toward positive infinity
+    struct ceiling_rounding_policy {
+        template<class To, class From>
+        static constexpr To convert(const From& from)
+        {
+            return (static_cast<From>(static_cast<To>(from))<from) ? static_cast<To>(from)+To{1} : static_cast<To>(from);
+        }
+
+        template<class Rep>
+        static constexpr Rep divide(const Rep& n, const Rep& d)
+        {
+            using namespace _precise_integer_impl;
+            return adjust(quotient(n, d), remainder(n, d)>Rep{0});
+        }
+    };
+
+    // round to nearest; halfway cases are rounded to the nearest even value
+    struct nearest_even_rounding_policy {
+        template<class To, class From>
+        static constexpr To convert(const From& from)
+        {
+            return rounded_up(floor_rounding_policy::convert<To>(from),
+                    from-static_cast<From>(floor_rounding_policy::convert<To>(from)));
+        }
+
+        template<class Rep>
+        static constexpr Rep divide(const Rep& n, const Rep& d)
+        {
+            using namespace _precise_integer_impl;
+            return (n>=Rep{0})
+                   ? rounded_up(quotient(n, d), remainder(n, d), static_cast<Rep>(d-remainder(n, d)))
+                   : static_cast<Rep>(-rounded_up(static_cast<Rep>(-quotient(n, d)),
+                           static_cast<Rep>(-remainder(n, d)), static_cast<Rep>(d+remainder(n, d))));
+        }
+
+    private:
+        // floor rounded up iff the fraction exceeds a half or equals it and floor is odd
+        template<class To, class From>
+        static constexpr To rounded_up(const To& floor, const From& fraction)
+        {
+            return (fraction>From(.5) || (fraction==From(.5) && floor%To{2}!=To{0})) ? floor+To{1} : floor;
+        }
+
+        // q rounded up iff the remainder, r, exceeds the shortfall, d-r, or equals it and q is odd
+        template<class Rep>
+        static constexpr Rep rounded_up(const Rep& q, const Rep& r, const Rep& shortfall)
+        {
+            return _precise_integer_impl::adjust(q, r>shortfall
+                    || (r==shortfall && _precise_integer_impl::remainder(q, Rep{2})!=Rep{0}));
         }
     };
 
@@ -72,9 +180,15 @@ namespace sg14 {
         using type = precise_integer<Value, RoundingTag>;
     };
 
-    template<class Rep, class RoundingTag>
-    struct scale<precise_integer<Rep, RoundingTag>>
-    : scale<_impl::number_base<precise_integer<Rep, RoundingTag>, Rep>> {
+    // digits which are lost are rounded as specified by RoundingPolicy
+    template<class Rep, class RoundingPolicy>
+    struct scale<precise_integer<Rep, RoundingPolicy>> {
+        template<class Input>
+        constexpr Rep operator()(const Input &i, int base, int exp) const {
+            return (exp < 0)
+                   ? RoundingPolicy::template divide<Rep>(_impl::to_rep(i), _num_traits_impl::pow<Rep>(base, -exp))
+                   : _impl::to_rep(i) * _num_traits_impl::pow<Rep>(base, exp);
+        }
     };
 
     namespace _precise_integer_impl {
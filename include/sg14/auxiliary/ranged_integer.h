@@ -0,0 +1,307 @@
+
+//          Copyright John McFarlane 2015 - 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief an integer which records the range of the values it holds
+
+#if !defined(SG14_RANGED_INTEGER_H)
+#define SG14_RANGED_INTEGER_H 1
+
+#include <sg14/bits/number_base.h>
+#include <sg14/bits/thread_records.h>
+#include <sg14/fixed_point>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+/// study group 14 of the C++ working group
+namespace sg14 {
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::range_profile
+
+    // the values held by the ranged_integer types of one key, summed over all threads
+    struct range_profile {
+        // number of buckets in the histogram; one for every number of digits an int64_t can need
+        static constexpr int num_buckets = 64;
+
+        char const* name;
+        std::uint64_t count;
+        std::int64_t min;
+        std::int64_t max;
+
+        // bitwise OR of every value; its lowest set bit is the lowest digit which was ever used
+        std::uint64_t bits;
+
+        // histogram[n] is the number of values which need exactly n digits, excluding any sign bit
+        std::uint64_t histogram[num_buckets];
+
+        // the fewest integer digits of a fixed_point with the given exponent which hold every value
+        int integer_digits(int exponent = 0) const
+        {
+            return count ? _impl::fp::used_bits(static_cast<std::uint64_t>((max>-1-min) ? max : -1-min))+exponent : 0;
+        }
+
+        // the fewest fractional digits of a fixed_point with the given exponent which hold every value exactly
+        int fractional_digits(int exponent = 0) const
+        {
+            return bits ? -exponent-(_impl::fp::used_bits(bits & (~bits+1))-1) : 0;
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // forward-declarations
+
+    template<class Rep, class Key>
+    class ranged_integer;
+
+    // implementation details
+    namespace _ranged_integer_impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // sg14::_ranged_integer_impl::is_ranged_integer
+
+        template<class T>
+        struct is_ranged_integer : std::false_type {
+        };
+
+        template<class Rep, class Key>
+        struct is_ranged_integer<ranged_integer<Rep, Key>> : std::true_type {
+        };
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // records
+
+        // the values of one key held by one thread; written only by that thread
+        struct range_record {
+            std::atomic<std::uint64_t> count{0};
+            std::atomic<std::int64_t> min{std::numeric_limits<std::int64_t>::max()};
+            std::atomic<std::int64_t> max{std::numeric_limits<std::int64_t>::min()};
+            std::atomic<std::uint64_t> bits{0};
+            std::atomic<std::uint64_t> histogram[range_profile::num_buckets];
+            range_record* next = nullptr;
+
+            range_record()
+            {
+                for (auto& bucket : histogram) {
+                    bucket.store(0, std::memory_order_relaxed);
+                }
+            }
+        };
+
+        // values of ranged_integer<Rep, void>, such as the results of arithmetic, are not recorded
+        template<class Key, _impl::enable_if_t<std::is_void<Key>::value, int> Dummy = 0>
+        void record_range(std::int64_t)
+        {
+        }
+
+        template<class Key, _impl::enable_if_t<!std::is_void<Key>::value, int> Dummy = 0>
+        void record_range(std::int64_t value)
+        {
+            auto& record = _impl::thread_record<range_record, Key>();
+            _impl::store_thread_record(record.count, record.count.load(std::memory_order_relaxed)+1);
+            _impl::store_thread_record(record.min, std::min(record.min.load(std::memory_order_relaxed), value));
+            _impl::store_thread_record(record.max, std::max(record.max.load(std::memory_order_relaxed), value));
+            _impl::store_thread_record(record.bits, record.bits.load(std::memory_order_relaxed) | static_cast<std::uint64_t>(value));
+
+            // a negative value, v, needs as many digits as ~v
+            auto& bucket = record.histogram[_impl::fp::used_bits(static_cast<std::uint64_t>((value<0) ? ~value : value))];
+            _impl::store_thread_record(bucket, bucket.load(std::memory_order_relaxed)+1);
+        }
+
+        // the records of one key summed over all threads;
+        // records which are being written concurrently may be slightly out of date
+        inline range_profile make_range_profile(_impl::thread_record_list<range_record> const& list)
+        {
+            auto profile = range_profile{list.name, 0, std::numeric_limits<std::int64_t>::max(), std::numeric_limits<std::int64_t>::min(), 0, {}};
+            for (auto record = list.records.load(std::memory_order_acquire); record; record = record->next) {
+                profile.count += record->count.load(std::memory_order_relaxed);
+                profile.min = std::min(profile.min, record->min.load(std::memory_order_relaxed));
+                profile.max = std::max(profile.max, record->max.load(std::memory_order_relaxed));
+                profile.bits |= record->bits.load(std::memory_order_relaxed);
+                for (auto bucket = 0; bucket!=range_profile::num_buckets; ++bucket) {
+                    profile.histogram[bucket] += record->histogram[bucket].load(std::memory_order_relaxed);
+                }
+            }
+            return profile;
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::ranged_integer<>
+
+    // an integer which records every value it is given against Key, so that the range of a variable
+    // can be measured by running an algorithm on captured data, e.g. with fixed_point<ranged_integer<int64_t, Key>, E>;
+    // Key is a user-defined type identifying the variable
+    // which has a static member function, name(), returning a null-terminated string;
+    // when Key is void, as it is for the results of arithmetic operations, nothing is recorded
+    template<class Rep = int, class Key = void>
+    class ranged_integer : public _impl::number_base<ranged_integer<Rep, Key>, Rep> {
+        static_assert(std::numeric_limits<Rep>::is_integer && std::numeric_limits<Rep>::digits<=63,
+                "values of Rep must be representable as std::int64_t");
+
+        using super = _impl::number_base<ranged_integer<Rep, Key>, Rep>;
+    public:
+        using key = Key;
+
+        ranged_integer() = default;
+
+        template<class T, _impl::enable_if_t<!_ranged_integer_impl::is_ranged_integer<T>::value, int> Dummy = 0>
+        ranged_integer(const T& v)
+                : super(static_cast<Rep>(v))
+        {
+            _ranged_integer_impl::record_range<Key>(static_cast<std::int64_t>(super::data()));
+        }
+
+        template<class RhsRep, class RhsKey>
+        ranged_integer(const ranged_integer<RhsRep, RhsKey>& rhs)
+                : ranged_integer(rhs.data())
+        {
+        }
+
+        // copies of values of the same type are not recorded again
+        ranged_integer(const ranged_integer&) = default;
+
+        ranged_integer& operator=(const ranged_integer&) = default;
+
+        template<class T>
+        ranged_integer& operator=(const T& rhs)
+        {
+            return *this = ranged_integer(rhs);
+        }
+
+        template<class T>
+        constexpr explicit operator T() const
+        {
+            return static_cast<T>(super::data());
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // numeric type traits
+
+    template<class Rep, class Key>
+    struct digits<ranged_integer<Rep, Key>> : digits<Rep> {
+    };
+
+    template<class Rep, class Key, _digits_type MinNumBits>
+    struct set_digits<ranged_integer<Rep, Key>, MinNumBits> {
+        using type = ranged_integer<set_digits_t<Rep, MinNumBits>, Key>;
+    };
+
+    namespace _impl {
+        template<class Rep, class Key>
+        struct get_rep<ranged_integer<Rep, Key>> {
+            using type = Rep;
+        };
+
+        template<class OldRep, class Key, class NewRep>
+        struct set_rep<ranged_integer<OldRep, Key>, NewRep> {
+            using type = ranged_integer<NewRep, Key>;
+        };
+    }
+
+    // operands which are converted to ranged_integer, e.g. the 2 in x*2, are not values of x
+    template<class Rep, class Key, class Value>
+    struct from_value<ranged_integer<Rep, Key>, Value> {
+        using type = ranged_integer<Value>;
+    };
+
+    template<class Rep, class Key>
+    struct scale<ranged_integer<Rep, Key>>
+            : scale<_impl::number_base<ranged_integer<Rep, Key>, Rep>> {
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // arithmetic
+
+    namespace _impl {
+        template<class Operator, class LhsRep, class LhsKey, class RhsRep, class RhsKey,
+                enable_if_t<Operator::is_arithmetic, int> Dummy = 0>
+        auto operate(
+                const ranged_integer<LhsRep, LhsKey>& lhs,
+                const ranged_integer<RhsRep, RhsKey>& rhs,
+                Operator)
+        -> ranged_integer<op_result<Operator, LhsRep, RhsRep>>
+        {
+            return Operator()(lhs.data(), rhs.data());
+        }
+
+        template<class Operator, class LhsRep, class LhsKey, class RhsRep, class RhsKey,
+                enable_if_t<Operator::is_comparison, int> Dummy = 0>
+        constexpr auto operate(
+                const ranged_integer<LhsRep, LhsKey>& lhs,
+                const ranged_integer<RhsRep, RhsKey>& rhs,
+                Operator)
+        -> decltype(Operator()(lhs.data(), rhs.data()))
+        {
+            return Operator()(lhs.data(), rhs.data());
+        }
+    }
+
+    template<class LhsRep, class LhsKey, class RhsInteger>
+    auto operator<<(
+            const ranged_integer<LhsRep, LhsKey>& lhs,
+            const RhsInteger& rhs)
+    -> ranged_integer<decltype(lhs.data() << rhs)>
+    {
+        return lhs.data() << rhs;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::range_profile_of, sg14::range_profiles, sg14::dump_range_profiles
+
+    // the values recorded against Key by every thread
+    template<class Key>
+    range_profile range_profile_of()
+    {
+        return _ranged_integer_impl::make_range_profile(_impl::thread_records<_ranged_integer_impl::range_record, Key>());
+    }
+
+    // the values recorded against each key which has been used
+    inline std::vector<range_profile> range_profiles()
+    {
+        std::vector<range_profile> profiles;
+        for (auto list = _impl::thread_record_lists<_ranged_integer_impl::range_record>().load(std::memory_order_acquire);
+             list;
+             list = list->next) {
+            profiles.push_back(_ranged_integer_impl::make_range_profile(*list));
+        }
+        return profiles;
+    }
+
+    // writes one line per key, "name: count [min, max] integer.fractional digits",
+    // followed by the non-empty buckets of the histogram, "digits: count", to stream;
+    // min and max are values of the rep, and digits are those of a fixed_point with the given exponent,
+    // e.g. E of fixed_point<ranged_integer<int64_t, Key>, E>, which applies to every key
+    inline void dump_range_profiles(std::FILE* stream = stderr, int exponent = 0)
+    {
+        for (auto const& profile : range_profiles()) {
+            std::fprintf(stream, "%s: %llu [%lld, %lld] %d.%d\n",
+                    profile.name, static_cast<unsigned long long>(profile.count),
+                    static_cast<long long>(profile.min), static_cast<long long>(profile.max),
+                    profile.integer_digits(exponent), profile.fractional_digits(exponent));
+            for (auto bucket = 0; bucket!=range_profile::num_buckets; ++bucket) {
+                if (profile.histogram[bucket]) {
+                    std::fprintf(stream, "  %d: %llu\n", bucket, static_cast<unsigned long long>(profile.histogram[bucket]));
+                }
+            }
+        }
+    }
+}
+
+namespace std {
+    ////////////////////////////////////////////////////////////////////////////////
+    // std::numeric_limits specialization for ranged_integer
+
+    template<class Rep, class Key>
+    struct numeric_limits<sg14::ranged_integer<Rep, Key>>
+            : numeric_limits<sg14::_impl::number_base<sg14::ranged_integer<Rep, Key>, Rep>> {};
+}
+
+#endif	// SG14_RANGED_INTEGER_H
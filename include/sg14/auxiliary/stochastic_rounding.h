@@ -0,0 +1,270 @@
+//          Copyright John McFarlane 2015 - 2016.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief stochastic rounding of `sg14::fixed_point` and `sg14::precise_integer` values
+/// using a per-thread source of pseudo-random bits
+
+#if !defined(SG14_STOCHASTIC_ROUNDING_H)
+#define SG14_STOCHASTIC_ROUNDING_H 1
+
+#include <sg14/fixed_point>
+
+#include "precise_integer.h"
+
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+/// study group 14 of the C++ working group
+namespace sg14 {
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // implementation-specific definitions
+
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // sg14::_impl::splitmix64
+
+        // steps of Vigna's splitmix64 finalizer
+        constexpr std::uint64_t splitmix64_scramble(std::uint64_t z)
+        {
+            return z ^ (z >> 31);
+        }
+
+        constexpr std::uint64_t splitmix64_multiply(std::uint64_t z, int shift, std::uint64_t multiplier)
+        {
+            return (z ^ (z >> shift))*multiplier;
+        }
+
+        // scrambles x so that similar seeds give unrelated generator states
+        constexpr std::uint64_t splitmix64(std::uint64_t x)
+        {
+            return splitmix64_scramble(splitmix64_multiply(
+                    splitmix64_multiply(x+UINT64_C(0x9e3779b97f4a7c15), 30, UINT64_C(0xbf58476d1ce4e5b9)),
+                    27, UINT64_C(0x94d049bb133111eb)));
+        }
+
+        // a valid xorshift64 state, i.e. non-zero, from any seed
+        constexpr std::uint64_t xorshift64_seed(std::uint64_t seed)
+        {
+            return splitmix64(seed) ? splitmix64(seed) : UINT64_C(1);
+        }
+
+        ////////////////////////////////////////////////////////////////////////////////
+        // sg14::_impl::xorshift64
+
+        // Marsaglia's xorshift64 generator; advances state and returns it
+        inline std::uint64_t xorshift64(std::uint64_t& state)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return state;
+        }
+
+        // generator state of the calling thread; zero until it is first used or seeded
+        inline std::uint64_t& stochastic_state()
+        {
+            static thread_local std::uint64_t state = 0;
+            return state;
+        }
+
+        // 64 pseudo-random bits;
+        // unless seeded, the state is derived from the thread's id so that no two threads share a sequence
+        inline std::uint64_t stochastic_bits()
+        {
+            auto& state = stochastic_state();
+            if (!state) {
+                state = xorshift64_seed(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+            }
+            return xorshift64(state);
+        }
+
+        // floating-point value, scaled, rounded down or up to an integer at random
+        // with the chance of rounding up equal to the fraction which is lost
+        template<class Integer, class S>
+        Integer stochastic_integer(S scaled)
+        {
+            auto truncated = static_cast<Integer>(scaled);
+            auto floor = static_cast<Integer>(truncated-Integer{static_cast<S>(truncated)>scaled});
+
+            // 53 random bits as a value in [0, 1)
+            auto threshold = static_cast<S>(stochastic_bits() >> 11)*S(1.1102230246251565404e-16);
+            return static_cast<Integer>(floor+Integer{threshold<scaled-static_cast<S>(floor)});
+        }
+    }
+
+    /// \brief seeds the generator which the calling thread uses for \ref stochastic_rounding
+    /// \headerfile sg14/auxiliary/stochastic_rounding.h
+    ///
+    /// \param seed any value; the same seed reproduces the same sequence of rounding decisions
+    inline void seed_stochastic_rounding(std::uint64_t seed)
+    {
+        _impl::stochastic_state() = _impl::xorshift64_seed(seed);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::stochastic_rounding
+
+    // round toward negative or positive infinity at random, the latter with a chance equal to
+    // the fraction which is lost, so that the expected result is exact;
+    // bits are drawn from a generator belonging to the calling thread (see seed_stochastic_rounding)
+    static constexpr struct stochastic_rounding_tag : _impl::fp::rounding_tag_base {
+    } stochastic_rounding{};
+
+    template<>
+    struct is_rounding_tag<stochastic_rounding_tag> : std::true_type {
+    };
+
+    namespace _impl {
+        namespace fp {
+            // the digits lost by a shift of Shift places, aligned to the top of a 64-bit fraction;
+            // beyond 64 places, only the most significant 64 lost digits are kept
+            template<int Shift, class Integer, enable_if_t<(Shift<=64), int> dummy = 0>
+            constexpr std::uint64_t stochastic_fraction(Integer value)
+            {
+                return static_cast<std::uint64_t>(value) << (64-Shift);
+            }
+
+            template<int Shift, class Integer, enable_if_t<(Shift>64), int> dummy = 0>
+            constexpr std::uint64_t stochastic_fraction(Integer value)
+            {
+                return static_cast<std::uint64_t>(rounding_shift<Shift-64>(floor_rounding, value));
+            }
+
+            // value * 2^-Shift rounded up iff random, a uniformly distributed 64-bit value, is below the lost fraction
+            template<int Shift, class Integer>
+            constexpr Integer stochastic_shift(Integer value, std::uint64_t random)
+            {
+                return static_cast<Integer>(rounding_shift<Shift>(floor_rounding, value)
+                        +Integer{random<stochastic_fraction<Shift>(value)});
+            }
+
+            template<int Shift, class Integer, enable_if_t<(Shift<=0), int> dummy = 0>
+            Integer rounding_shift(stochastic_rounding_tag, Integer value)
+            {
+                return rounding_shift<Shift>(floor_rounding, value);
+            }
+
+            template<int Shift, class Integer, enable_if_t<(Shift>0), int> dummy = 0>
+            Integer rounding_shift(stochastic_rounding_tag, Integer value)
+            {
+                return stochastic_shift<Shift>(value, stochastic_bits());
+            }
+
+            template<class Integer, class S>
+            Integer rounding_integer(stochastic_rounding_tag, S scaled)
+            {
+                return stochastic_integer<Integer>(scaled);
+            }
+
+            // number of generators which bulk stochastic rounding advances side by side
+            constexpr int stochastic_lanes = 8;
+
+            // no digits are lost
+            template<class Output, class Rep, int Exponent,
+                    enable_if_t<(Output::exponent<=Exponent), int> dummy = 0>
+            void stochastic_convert(fixed_point<Rep, Exponent> const* input, Output* output, std::size_t size)
+            {
+                for (auto last = input+size; input!=last; ++input, ++output) {
+                    *output = static_cast<Output>(*input);
+                }
+            }
+
+            // independent generators, each seeded from the thread's generator,
+            // leave no dependency between neighboring elements
+            template<class Output, class Rep, int Exponent,
+                    enable_if_t<(Output::exponent>Exponent), int> dummy = 0>
+            void stochastic_convert(fixed_point<Rep, Exponent> const* input, Output* output, std::size_t size)
+            {
+                constexpr int shift = Output::exponent-Exponent;
+                using output_rep = typename Output::rep;
+
+                std::uint64_t lanes[stochastic_lanes];
+                for (auto& lane : lanes) {
+                    lane = xorshift64_seed(stochastic_bits());
+                }
+
+                for (; size>=stochastic_lanes; size -= stochastic_lanes) {
+                    for (auto& lane : lanes) {
+                        lane ^= lane << 13;
+                        lane ^= lane >> 7;
+                        lane ^= lane << 17;
+                    }
+                    for (auto lane = 0; lane!=stochastic_lanes; ++lane) {
+                        output[lane] = Output::from_data(static_cast<output_rep>(
+                                stochastic_shift<shift>(input[lane].data(), lanes[lane])));
+                    }
+                    input += stochastic_lanes;
+                    output += stochastic_lanes;
+                }
+
+                for (auto lane = 0; lane!=static_cast<int>(size%stochastic_lanes); ++lane) {
+                    output[lane] = Output::from_data(static_cast<output_rep>(
+                            stochastic_shift<shift>(input[lane].data(), xorshift64(lanes[lane]))));
+                }
+            }
+        }
+    }
+
+    /// \brief converts each of the \a size elements of \a input with \ref stochastic_rounding
+    /// \headerfile sg14/auxiliary/stochastic_rounding.h
+    ///
+    /// Elements are rounded in groups by several generators at once
+    /// so that the loop can be vectorized.
+    ///
+    /// \param input the first element of an array of inputs
+    /// \param output the first element of an array of \a size results
+    /// \param size the number of elements
+    ///
+    /// \sa convert(RoundingTag, fixed_point<Rep, Exponent> const&), seed_stochastic_rounding
+
+    template<class OutputRep, int OutputExponent, class Rep, int Exponent>
+    void convert(stochastic_rounding_tag, fixed_point<Rep, Exponent> const* input,
+            fixed_point<OutputRep, OutputExponent>* output, std::size_t size)
+    {
+        _impl::fp::stochastic_convert(input, output, size);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::stochastic_rounding_policy
+
+    namespace _precise_integer_impl {
+        // a random value in [0, d) where d is positive;
+        // slightly biased unless d is a power of two no greater than 2^63
+        template<class Rep, _impl::enable_if_t<(std::numeric_limits<Rep>::digits<64), int> Dummy = 0>
+        Rep stochastic_below(const Rep& d)
+        {
+            return static_cast<Rep>(_impl::stochastic_bits()%static_cast<std::uint64_t>(d));
+        }
+
+        template<class Rep, _impl::enable_if_t<(std::numeric_limits<Rep>::digits>=64), int> Dummy = 0>
+        Rep stochastic_below(const Rep& d)
+        {
+            return remainder(static_cast<Rep>(_impl::stochastic_bits() >> 1), d);
+        }
+    }
+
+    // rounds down or up at random, the latter with a chance equal to the fraction which is lost;
+    // see seed_stochastic_rounding
+    struct stochastic_rounding_policy {
+        template<class To, class From>
+        static To convert(const From& from)
+        {
+            return _impl::stochastic_integer<To>(from);
+        }
+
+        template<class Rep>
+        static Rep divide(const Rep& n, const Rep& d)
+        {
+            using namespace _precise_integer_impl;
+            return adjust(floor_rounding_policy::divide(n, d),
+                    stochastic_below(d)<static_cast<Rep>(n-floor_rounding_policy::divide(n, d)*d));
+        }
+    };
+}
+
+#endif	// SG14_STOCHASTIC_ROUNDING_H
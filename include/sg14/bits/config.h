@@ -44,4 +44,57 @@ using SG14_UINT128 = unsigned __int128;
 #define SG14_EXCEPTIONS_ENABLED
 #endif
 
+////////////////////////////////////////////////////////////////////////////////
+// SG14_OVERFLOW_BUILTINS_ENABLED macro definition
+
+#if defined(SG14_OVERFLOW_BUILTINS_ENABLED)
+#error SG14_OVERFLOW_BUILTINS_ENABLED already defined
+#endif
+
+// __builtin_add_overflow and friends detect overflow from the flags of the operation itself
+#if defined(__clang__)
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_add_overflow) && __has_builtin(__builtin_sub_overflow) && __has_builtin(__builtin_mul_overflow)
+#define SG14_OVERFLOW_BUILTINS_ENABLED
+#endif
+#endif
+#elif defined(__GNUG__)
+#if (__GNUC__>=5)
+#define SG14_OVERFLOW_BUILTINS_ENABLED
+#endif
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// SG14_SSE2_ENABLED and SG14_AVX2_ENABLED macro definitions
+
+#if defined(SG14_SSE2_ENABLED)
+#error SG14_SSE2_ENABLED already defined
+#endif
+
+#if defined(SG14_AVX2_ENABLED)
+#error SG14_AVX2_ENABLED already defined
+#endif
+
+// instruction sets which the compiler targets and which the bulk fixed_point kernels can use
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP>=2)
+#define SG14_SSE2_ENABLED
+#endif
+
+#if defined(__AVX2__)
+#define SG14_AVX2_ENABLED
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// SG14_SIMD_DISPATCH_ENABLED macro definition
+
+#if defined(SG14_SIMD_DISPATCH_ENABLED)
+#error SG14_SIMD_DISPATCH_ENABLED already defined
+#endif
+
+// GCC/Clang x86 builds can compile functions for instruction sets which they do not target
+// and choose between them at run time according to what the processor supports
+#if defined(SG14_SSE2_ENABLED) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define SG14_SIMD_DISPATCH_ENABLED
+#endif
+
 #endif // SG14_CONFIG_H
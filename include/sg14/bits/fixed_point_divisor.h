@@ -0,0 +1,143 @@
+
+//          Copyright John McFarlane 2015 - 2016.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief division of `sg14::fixed_point` values by a divisor whose reciprocal is calculated once;
+/// included from sg14/fixed_point - do not include directly!
+
+#if !defined(SG14_FIXED_POINT_DIVISOR_H)
+#define SG14_FIXED_POINT_DIVISOR_H 1
+
+#include "fixed_point_math.h"
+
+/// study group 14 of the C++ working group
+namespace sg14 {
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // implementation-specific definitions
+
+    namespace _impl {
+        namespace fp {
+            //Number of places a non-zero value is shifted left to set its most significant bit
+            constexpr int divisor_shift(std::uint64_t d) {
+                return d ? 64 - used_bits(d) : 0;
+            }
+
+            //d with its most significant bit set; zero if d is zero
+            constexpr std::uint64_t divisor_normalize(std::uint64_t d) {
+                return d << divisor_shift(d);
+            }
+
+            //reciprocal_word of a normalized divisor; zero if it is zero
+            constexpr std::uint64_t divisor_reciprocal(std::uint64_t normalized) {
+                return normalized ? reciprocal_word(normalized) : 0;
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::fixed_divisor
+
+    /// \brief a \ref fixed_point divisor prepared for repeated division
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \tparam FixedPoint the \ref fixed_point type of the divisor
+    ///
+    /// Construction finds the reciprocal of the divisor with the Newton-Raphson iterations
+    /// used by `divide(fast_reciprocal, lhs, rhs)`.
+    /// Each subsequent division needs only a 64x64-bit multiplication and a correction
+    /// which is exact for any dividend whose rep is no wider than 64 bits.
+    /// \code
+    /// auto gain = fixed_divisor<fixed_point<int32_t, -16>>{fixed_point<int32_t, -16>{3}};
+    /// for (auto& sample : samples) {
+    ///     sample = sample / gain;
+    /// }
+    /// \endcode
+    ///
+    /// \sa divide
+
+    template<class FixedPoint>
+    class fixed_divisor {
+        static_assert(digits<typename FixedPoint::rep>::value <= 64, "division by this type is not supported");
+
+    public:
+        /// alias to template parameter, \a FixedPoint
+        using value_type = FixedPoint;
+
+        /// prepares to divide by \a divisor
+        explicit constexpr fixed_divisor(value_type const& divisor)
+                : _value(divisor),
+                  _normalized(_impl::fp::divisor_normalize(_impl::fp::magnitude(divisor.data()))),
+                  _reciprocal(_impl::fp::divisor_reciprocal(_normalized)),
+                  _shift(_impl::fp::divisor_shift(_impl::fp::magnitude(divisor.data()))) { }
+
+        /// returns the divisor
+        constexpr value_type value() const {
+            return _value;
+        }
+
+        /// returns the quotient of \a lhs and the divisor as \a Output, rounded toward zero;
+        /// saturated if it cannot be represented by Output or if the divisor is zero
+        template<class Output, class Rep, int Exponent>
+        constexpr Output quotient(fixed_point<Rep, Exponent> const& lhs) const {
+            static_assert(digits<Rep>::value <= 64 && digits<typename Output::rep>::value <= 64,
+                    "division of this type is not supported");
+            return _impl::fp::reciprocal_result<Output>(
+                    _normalized ?
+                    _impl::fp::reciprocal_shifted(_impl::fp::magnitude(lhs.data()),
+                            Exponent - FixedPoint::exponent - Output::exponent + _shift, _normalized, _reciprocal)
+                                : ~std::uint64_t{0},
+                    (lhs.data() < Rep{0}) != (_value.data() < typename FixedPoint::rep{0}));
+        }
+
+    private:
+        value_type _value;
+        std::uint64_t _normalized;
+        std::uint64_t _reciprocal;
+        int _shift;
+    };
+
+    /// \brief calculates the quotient of a \ref fixed_point value and a \ref fixed_divisor
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \tparam Output the fixed_point type of the result
+    /// \param lhs, rhs dividend and divisor
+    ///
+    /// \return quotient: lhs / rhs as Output, rounded toward zero;
+    /// saturated if it cannot be represented by Output or if rhs is zero
+    ///
+    /// \sa fixed_divisor
+    template<class Output, class Rep, int Exponent, class Divisor>
+    constexpr Output divide(fast_reciprocal_tag, fixed_point<Rep, Exponent> const& lhs, fixed_divisor<Divisor> const& rhs) {
+        return rhs.template quotient<Output>(lhs);
+    }
+
+    /// \brief calculates the quotient of a \ref fixed_point value and a \ref fixed_divisor in the type of the dividend
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param lhs, rhs dividend and divisor
+    ///
+    /// \return quotient: lhs / rhs in the same representation as lhs, rounded toward zero;
+    /// saturated if it cannot be represented or if rhs is zero
+    ///
+    /// \sa fixed_divisor
+    template<class Rep, int Exponent, class Divisor>
+    constexpr fixed_point<Rep, Exponent> divide(fast_reciprocal_tag, fixed_point<Rep, Exponent> const& lhs,
+            fixed_divisor<Divisor> const& rhs) {
+        return rhs.template quotient<fixed_point<Rep, Exponent>>(lhs);
+    }
+
+    /// \brief calculates the quotient of a \ref fixed_point value and a \ref fixed_divisor in the type of the dividend
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \sa fixed_divisor, divide
+    template<class Rep, int Exponent, class Divisor>
+    constexpr fixed_point<Rep, Exponent> operator/(fixed_point<Rep, Exponent> const& lhs, fixed_divisor<Divisor> const& rhs) {
+        return rhs.template quotient<fixed_point<Rep, Exponent>>(lhs);
+    }
+}
+
+#endif	// SG14_FIXED_POINT_DIVISOR_H
@@ -62,12 +62,46 @@ namespace sg14 {
         return (x >= 0) ? static_cast<decltype(-x)>(x) : -x;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::_impl::fp::used_bits - number of bits needed to represent an unsigned value
+
+    namespace _impl {
+        namespace fp {
+#if defined(_MSC_VER)
+            constexpr int used_bits(std::uint64_t value, int mask_bits = 32)
+            {
+                return (value>=(std::uint64_t{1} << mask_bits))
+                       ? mask_bits+used_bits(value >> mask_bits, mask_bits)
+                       : (mask_bits>1)
+                         ? used_bits(value, mask_bits/2)
+                         : static_cast<int>(value);
+            }
+#else
+            constexpr int used_bits(std::uint64_t value)
+            {
+                return value ? 64-__builtin_clzll(value) : 0;
+            }
+#endif
+
+#if defined(SG14_INT128_ENABLED)
+            constexpr int used_bits(SG14_UINT128 value)
+            {
+                return (value >> 64)
+                       ? 64+used_bits(static_cast<std::uint64_t>(value >> 64))
+                       : used_bits(static_cast<std::uint64_t>(value));
+            }
+#endif
+        }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////
     // sg14::sqrt helper functions
 
     namespace _impl {
         namespace fp {
             namespace extras {
+                // bit-by-bit solution which works with any integer-like Rep
+
                 template<class Rep>
                 constexpr Rep sqrt_bit(Rep n, Rep bit)
                 {
@@ -101,6 +135,134 @@ namespace sg14 {
                 {
                     return sqrt_solve3<Rep>(n, sqrt_bit<Rep>(n), Rep{0});
                 }
+
+                // Newton-Raphson solution for built-in integers
+
+                template<class Integer>
+                struct is_native_integer : std::is_integral<Integer> {
+                };
+
+#if defined(SG14_INT128_ENABLED)
+                template<>
+                struct is_native_integer<SG14_INT128> : std::true_type {
+                };
+
+                template<>
+                struct is_native_integer<SG14_UINT128> : std::true_type {
+                };
+#endif
+
+                template<class Dummy = void>
+                struct sqrt_constants {
+                    // sqrt((i+64.5)/64)*256-256, i.e. the square root of a mantissa in the range [1, 4)
+                    // to 8 fractional digits, indexed by the mantissa's top 8 bits minus 64
+                    static constexpr int num_seeds = 192;
+                    static constexpr unsigned char seeds[num_seeds] = {
+                              1,   3,   5,   7,   9,  11,  13,  15,  16,  18,  20,  22,  24,  26,  28,  29,
+                             31,  33,  35,  36,  38,  40,  42,  43,  45,  47,  48,  50,  52,  53,  55,  57,
+                             58,  60,  62,  63,  65,  66,  68,  70,  71,  73,  74,  76,  77,  79,  80,  82,
+                             83,  85,  86,  88,  89,  91,  92,  94,  95,  97,  98, 100, 101, 102, 104, 105,
+                            107, 108, 110, 111, 112, 114, 115, 116, 118, 119, 121, 122, 123, 125, 126, 127,
+                            129, 130, 131, 133, 134, 135, 137, 138, 139, 140, 142, 143, 144, 146, 147, 148,
+                            149, 151, 152, 153, 154, 156, 157, 158, 159, 161, 162, 163, 164, 166, 167, 168,
+                            169, 170, 172, 173, 174, 175, 176, 177, 179, 180, 181, 182, 183, 185, 186, 187,
+                            188, 189, 190, 191, 193, 194, 195, 196, 197, 198, 199, 200, 202, 203, 204, 205,
+                            206, 207, 208, 209, 210, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222,
+                            223, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+                            240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255
+                    };
+                };
+
+                template<class Dummy>
+                constexpr int sqrt_constants<Dummy>::num_seeds;
+                template<class Dummy>
+                constexpr unsigned char sqrt_constants<Dummy>::seeds[sqrt_constants<Dummy>::num_seeds];
+
+                template<class Unsigned, _impl::enable_if_t<(digits<Unsigned>::value<=64), int> dummy = 0>
+                constexpr int sqrt_used_bits(Unsigned n)
+                {
+                    return used_bits(static_cast<std::uint64_t>(n));
+                }
+
+#if defined(SG14_INT128_ENABLED)
+                template<class Unsigned, _impl::enable_if_t<(digits<Unsigned>::value>64), int> dummy = 0>
+                constexpr int sqrt_used_bits(Unsigned n)
+                {
+                    return used_bits(static_cast<SG14_UINT128>(n));
+                }
+#endif
+
+                // first approximation of sqrt(n) from the seed table given
+                // an even shift which moves the leading 1 of n into one of its top two bits
+                template<class Unsigned>
+                constexpr Unsigned sqrt_seed(Unsigned n, int shift)
+                {
+                    return static_cast<Unsigned>(
+                            (static_cast<Unsigned>(sqrt_constants<>::seeds[
+                                    static_cast<int>((n << shift) >> (digits<Unsigned>::value-8))-64]+256u)
+                                    << (digits<Unsigned>::value/2-1))
+                                    >> (8+shift/2));
+                }
+
+                template<class Unsigned>
+                constexpr Unsigned sqrt_seed(Unsigned n)
+                {
+                    return sqrt_seed<Unsigned>(n, (digits<Unsigned>::value-sqrt_used_bits(n)) & ~1);
+                }
+
+                template<class Unsigned>
+                constexpr Unsigned sqrt_newton(Unsigned n, Unsigned estimate)
+                {
+                    return static_cast<Unsigned>((estimate+n/estimate) >> 1);
+                }
+
+                // the seed is accurate to 7 bits and each iteration doubles that
+                template<class Unsigned, _impl::enable_if_t<(digits<Unsigned>::value<=32), int> dummy = 0>
+                constexpr Unsigned sqrt_refine(Unsigned n, Unsigned estimate)
+                {
+                    return sqrt_newton(n, estimate);
+                }
+
+                template<class Unsigned, _impl::enable_if_t<(digits<Unsigned>::value>32
+                        && digits<Unsigned>::value<=64), int> dummy = 0>
+                constexpr Unsigned sqrt_refine(Unsigned n, Unsigned estimate)
+                {
+                    return sqrt_newton(n, sqrt_newton(n, estimate));
+                }
+
+                template<class Unsigned, _impl::enable_if_t<(digits<Unsigned>::value>64), int> dummy = 0>
+                constexpr Unsigned sqrt_refine(Unsigned n, Unsigned estimate)
+                {
+                    return sqrt_newton(n, sqrt_newton(n, sqrt_newton(n, estimate)));
+                }
+
+                // a Newton-Raphson iteration never undershoots floor(sqrt(n))
+                // and after sqrt_refine, overshoots by at most 1
+                template<class Unsigned>
+                constexpr Unsigned sqrt_correct(Unsigned n, Unsigned estimate)
+                {
+                    return (estimate*estimate>n) ? static_cast<Unsigned>(estimate-1u) : estimate;
+                }
+
+                template<class Unsigned>
+                constexpr Unsigned sqrt_unsigned(Unsigned n)
+                {
+                    return n ? sqrt_correct(n, _impl::min(
+                            sqrt_refine(n, sqrt_seed(n)),
+                            static_cast<Unsigned>((Unsigned{1} << (digits<Unsigned>::value/2))-1u))) : n;
+                }
+
+                template<class Rep, _impl::enable_if_t<is_native_integer<Rep>::value, int> dummy = 0>
+                constexpr Rep sqrt_solve(Rep n)
+                {
+                    return static_cast<Rep>(sqrt_unsigned(static_cast<make_unsigned_t<Rep>>(n)));
+                }
+
+                template<class Rep, _impl::enable_if_t<!is_native_integer<Rep>::value, int> dummy = 0>
+                constexpr Rep sqrt_solve(Rep n)
+                {
+                    return sqrt_solve1(n);
+                }
             }
         }
     }
@@ -113,17 +275,14 @@ namespace sg14 {
     ///
     /// \param x input parameter
     ///
-    /// \return square root of x
+    /// \return square root of x, rounded down
     ///
-    /// \note This function is a placeholder implementation with poor run-time performance characteristics.
-    /// \note It uses
-    /// divides the values
-    /// without performing any additional scaling or conversion.
+    /// \note When Rep is a built-in integer, an estimate is looked up from the leading bits of the value
+    /// and refined using Newton-Raphson iteration; otherwise the root is found one bit at a time.
     ///
     /// \sa negate, add, subtract, multiply
 
     // https://en.wikipedia.org/wiki/Methods_of_computing_square_roots#Binary_numeral_system_.28base_2.29
-    // ?
     template<class Rep, int Exponent>
     constexpr fixed_point <Rep, Exponent>
     sqrt(const fixed_point <Rep, Exponent>& x)
@@ -135,57 +294,589 @@ namespace sg14 {
                 ? throw std::invalid_argument("cannot represent square root of negative value") :
 #endif
                 fixed_point<Rep, Exponent>::from_data(
-                        static_cast<Rep>(_impl::fp::extras::sqrt_solve1(widened_type{x}.data())));
+                        static_cast<Rep>(_impl::fp::extras::sqrt_solve(widened_type{x}.data())));
     }
 
     ////////////////////////////////////////////////////////////////////////////////
-    // sg14::trig
+    // sg14::floor, sg14::ceil, sg14::trunc and sg14::round helper functions
     //
-    // Placeholder implementations fall back on <cmath> functions which is slow
-    // due to conversion to and from floating-point types; also inconvenient as
-    // many <cmath> functions are not constexpr.
+    // The fractional bits of the underlying value are cleared with a mask,
+    // after adding an offset for ceil and round. Arithmetic is performed in the
+    // unsigned type to which Rep is promoted so that it is well defined for
+    // negative values and for masks which cover every bit.
 
     namespace _impl {
         namespace fp {
             namespace extras {
-                template<class Rep, int Exponent, _impl::fp::float_of_same_size<Rep>(* F)(
-                        _impl::fp::float_of_same_size<Rep>)>
-                constexpr fixed_point <Rep, Exponent>
-                crib(const fixed_point <Rep, Exponent>& x) noexcept
+                template<class Rep>
+                using rounding_rep = make_unsigned_t<decltype(+Rep{})>;
+
+                template<class Rep, _impl::enable_if_t<is_signed<Rep>::value, int> dummy = 0>
+                constexpr bool is_negative_data(Rep data)
+                {
+                    return data<Rep{0};
+                }
+
+                template<class Rep, _impl::enable_if_t<!is_signed<Rep>::value, int> dummy = 0>
+                constexpr bool is_negative_data(Rep)
+                {
+                    return false;
+                }
+
+                template<class Rep>
+                constexpr rounding_rep<Rep> magnitude_data(Rep data)
                 {
-                    using floating_point = _impl::fp::float_of_same_size<Rep>;
-                    return static_cast<fixed_point<Rep, Exponent>>(F(static_cast<floating_point>(x)));
+                    return is_negative_data(data)
+                           ? static_cast<rounding_rep<Rep>>(rounding_rep<Rep>{0}-static_cast<rounding_rep<Rep>>(data))
+                           : static_cast<rounding_rep<Rep>>(data);
+                }
+
+                // clears the lowest FractionalDigits bits
+                template<class Rep, int FractionalDigits>
+                constexpr rounding_rep<Rep> integer_mask()
+                {
+                    return FractionalDigits>=digits<rounding_rep<Rep>>::value
+                           ? rounding_rep<Rep>{0}
+                           : static_cast<rounding_rep<Rep>>(~rounding_rep<Rep>{0}
+                                   << _impl::min(FractionalDigits, digits<rounding_rep<Rep>>::value-1));
+                }
+
+                template<class Rep, int FractionalDigits>
+                constexpr Rep mask_integer(rounding_rep<Rep> offset_data)
+                {
+                    return static_cast<Rep>(offset_data & integer_mask<Rep, FractionalDigits>());
+                }
+
+                template<class Rep, int FractionalDigits>
+                constexpr Rep floor_data(Rep data)
+                {
+                    return mask_integer<Rep, FractionalDigits>(static_cast<rounding_rep<Rep>>(data));
+                }
+
+                template<class Rep, int FractionalDigits>
+                constexpr Rep ceil_data(Rep data)
+                {
+                    return mask_integer<Rep, FractionalDigits>(static_cast<rounding_rep<Rep>>(
+                            static_cast<rounding_rep<Rep>>(data)+static_cast<rounding_rep<Rep>>(
+                                    ~integer_mask<Rep, FractionalDigits>())));
+                }
+
+                template<class Rep, int FractionalDigits>
+                constexpr Rep trunc_data(Rep data)
+                {
+                    return is_negative_data(data) ? ceil_data<Rep, FractionalDigits>(data) : floor_data<Rep, FractionalDigits>(data);
+                }
+
+                // adds one half, or just less than one half to negative values, then rounds down
+                template<class Rep, int FractionalDigits>
+                constexpr Rep round_data(Rep data)
+                {
+                    return mask_integer<Rep, FractionalDigits>(static_cast<rounding_rep<Rep>>(
+                            static_cast<rounding_rep<Rep>>(data)
+                                    +(static_cast<rounding_rep<Rep>>(~integer_mask<Rep, FractionalDigits>()) >> 1)
+                                    +rounding_rep<Rep>{is_negative_data(data) ? 0u : 1u}));
+                }
+
+                // the quotient and remainder of the lowest value and -1 are undefined, although the remainder is 0
+                template<class Rep, _impl::enable_if_t<is_signed<Rep>::value, int> dummy = 0>
+                constexpr bool is_minus_one_data(Rep data)
+                {
+                    return data==Rep{-1};
+                }
+
+                template<class Rep, _impl::enable_if_t<!is_signed<Rep>::value, int> dummy = 0>
+                constexpr bool is_minus_one_data(Rep)
+                {
+                    return false;
+                }
+
+                // remainder rounded to nearest, halfway cases to even, given the truncated quotient and remainder
+                template<class Rep>
+                constexpr Rep remainder_data(Rep quotient, Rep remainder, Rep divisor)
+                {
+                    return (magnitude_data(remainder)>magnitude_data(divisor)-magnitude_data(remainder)
+                            || (magnitude_data(remainder)==magnitude_data(divisor)-magnitude_data(remainder)
+                                    && (quotient%2)!=0))
+                           ? static_cast<Rep>(is_negative_data(remainder)==is_negative_data(divisor)
+                                              ? remainder-divisor
+                                              : remainder+divisor)
+                           : remainder;
                 }
             }
         }
     }
 
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::floor, sg14::ceil, sg14::trunc and sg14::round
+
+    /// \brief rounds a \ref fixed_point value down to an integer
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \return the largest integer no greater than x, in the type of x
+    ///
+    /// \note Results which cannot be represented wrap around, as with built-in integer arithmetic.
+    ///
+    /// \sa ceil, trunc, round
     template<class Rep, int Exponent>
-    constexpr fixed_point <Rep, Exponent>
-    sin(const fixed_point <Rep, Exponent>& x) noexcept
+    constexpr fixed_point<Rep, Exponent> floor(const fixed_point<Rep, Exponent>& x)
     {
-        return _impl::fp::extras::crib<Rep, Exponent, std::sin>(x);
+        return (Exponent>=0) ? x : fixed_point<Rep, Exponent>::from_data(
+                _impl::fp::extras::floor_data<Rep, _impl::max(0, -Exponent)>(x.data()));
     }
 
+    /// \brief rounds a \ref fixed_point value up to an integer
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \return the smallest integer no less than x, in the type of x
+    ///
+    /// \note Results which cannot be represented wrap around, as with built-in integer arithmetic.
+    ///
+    /// \sa floor, trunc, round
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> ceil(const fixed_point<Rep, Exponent>& x)
+    {
+        return (Exponent>=0) ? x : fixed_point<Rep, Exponent>::from_data(
+                _impl::fp::extras::ceil_data<Rep, _impl::max(0, -Exponent)>(x.data()));
+    }
+
+    /// \brief rounds a \ref fixed_point value toward zero
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \return the nearest integer no greater in magnitude than x, in the type of x
+    ///
+    /// \sa floor, ceil, round
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> trunc(const fixed_point<Rep, Exponent>& x)
+    {
+        return (Exponent>=0) ? x : fixed_point<Rep, Exponent>::from_data(
+                _impl::fp::extras::trunc_data<Rep, _impl::max(0, -Exponent)>(x.data()));
+    }
+
+    /// \brief rounds a \ref fixed_point value to the nearest integer
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \return the integer nearest to x, in the type of x; halfway cases are rounded away from zero
+    ///
+    /// \note Results which cannot be represented wrap around, as with built-in integer arithmetic.
+    ///
+    /// \sa floor, ceil, trunc
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> round(const fixed_point<Rep, Exponent>& x)
+    {
+        return (Exponent>=0) ? x : fixed_point<Rep, Exponent>::from_data(
+                _impl::fp::extras::round_data<Rep, _impl::max(0, -Exponent)>(x.data()));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::fmod, sg14::remainder and sg14::modf
+
+    /// \brief calculates the remainder of the division of one \ref fixed_point value by another
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \return x - trunc(x/y)*y, calculated exactly from the remainder of the underlying values
+    ///
+    /// \sa remainder, trunc
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> fmod(const fixed_point<Rep, Exponent>& x, const fixed_point<Rep, Exponent>& y)
+    {
+        return fixed_point<Rep, Exponent>::from_data(_impl::fp::extras::is_minus_one_data(y.data())
+                                                     ? Rep{0}
+                                                     : static_cast<Rep>(x.data()%y.data()));
+    }
+
+    /// \brief calculates the IEEE remainder of the division of one \ref fixed_point value by another
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \return x - n*y where n is x/y rounded to the nearest integer, halfway cases to even;
+    /// calculated exactly from the quotient and remainder of the underlying values
+    ///
+    /// \sa fmod, round
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> remainder(const fixed_point<Rep, Exponent>& x, const fixed_point<Rep, Exponent>& y)
+    {
+        return fixed_point<Rep, Exponent>::from_data(_impl::fp::extras::is_minus_one_data(y.data())
+                                                     ? Rep{0}
+                                                     : _impl::fp::extras::remainder_data<Rep>(
+                                                             static_cast<Rep>(x.data()/y.data()),
+                                                             static_cast<Rep>(x.data()%y.data()), y.data()));
+    }
+
+    /// \brief splits a \ref fixed_point value into integer and fractional parts
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param x input parameter
+    /// \param integer_part receives trunc(x)
+    ///
+    /// \return the fractional part of x, which has the same sign as x
+    ///
+    /// \sa trunc
+#if (__cplusplus>=201402L)
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> modf(const fixed_point<Rep, Exponent>& x, fixed_point<Rep, Exponent>* integer_part)
+    {
+        *integer_part = trunc(x);
+        return fixed_point<Rep, Exponent>::from_data(static_cast<Rep>(x.data()-integer_part->data()));
+    }
+#else
+    template<class Rep, int Exponent>
+    fixed_point<Rep, Exponent> modf(const fixed_point<Rep, Exponent>& x, fixed_point<Rep, Exponent>* integer_part)
+    {
+        *integer_part = trunc(x);
+        return fixed_point<Rep, Exponent>::from_data(static_cast<Rep>(x.data()-integer_part->data()));
+    }
+#endif
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::sin, sg14::cos and sg14::atan helper functions
+    //
+    // CORDIC (https://en.wikipedia.org/wiki/CORDIC) is performed using only
+    // shifts and additions of 64-bit integers. Results are therefore constexpr
+    // and identical on every platform regardless of floating-point support.
+
+    namespace _impl {
+        namespace fp {
+            namespace extras {
+                // intermediate values have 2 integer digits and 61 fractional digits
+                using cordic_rep = std::int64_t;
+                constexpr int cordic_fractional_digits = 61;
+
+                template<class Dummy = void>
+                struct cordic_constants {
+                    // atan(2^-i) for i < 21; beyond that, atan(2^-i) rounds to 2^-i
+                    static constexpr int num_angles = 21;
+                    static constexpr cordic_rep angles[num_angles] = {
+                            0x1921fb54442d1847, 0x0ed63382b0dda7b4, 0x07d6dd7e4b203759, 0x03fab7535585edb9,
+                            0x01ff55bb72cfde9c, 0x00ffeaaddd4bb125, 0x007ffd556eedca6b, 0x003fffaaab77752e,
+                            0x001ffff5555bbbb7, 0x000ffffeaaaaddde, 0x0007ffffd55556ef, 0x0003fffffaaaaab7,
+                            0x0001ffffff555556, 0x0000ffffffeaaaab, 0x00007ffffffd5555, 0x00003fffffffaaab,
+                            0x00001ffffffff555, 0x00000ffffffffeab, 0x000007ffffffffd5, 0x000003fffffffffb,
+                            0x000001ffffffffff
+                    };
+
+                    // pi/2
+                    static constexpr cordic_rep half_pi = 0x3243f6a8885a308d;
+
+                    // reciprocal of the CORDIC gain, i.e. the product of cos(atan(2^-i))
+                    static constexpr cordic_rep inverse_gain = 0x136e9db5086bcb4d;
+                };
+
+                template<class Dummy>
+                constexpr int cordic_constants<Dummy>::num_angles;
+                template<class Dummy>
+                constexpr cordic_rep cordic_constants<Dummy>::angles[cordic_constants<Dummy>::num_angles];
+                template<class Dummy>
+                constexpr cordic_rep cordic_constants<Dummy>::half_pi;
+                template<class Dummy>
+                constexpr cordic_rep cordic_constants<Dummy>::inverse_gain;
+
+                constexpr cordic_rep cordic_angle(int iteration)
+                {
+                    return (iteration<cordic_constants<>::num_angles)
+                           ? cordic_constants<>::angles[iteration]
+                           : cordic_rep{1} << (cordic_fractional_digits-iteration);
+                }
+
+                // enough iterations that the residual angle is below a quarter of an LSB
+                constexpr int cordic_iterations(int fractional_digits)
+                {
+                    return _impl::max(1, _impl::min(fractional_digits+3, cordic_fractional_digits+1));
+                }
+
+                struct cordic_vector {
+                    cordic_rep x;
+                    cordic_rep y;
+                    cordic_rep z;
+                };
+
+                // value if mask is 0; -value if mask is -1
+                constexpr cordic_rep cordic_negate_if(cordic_rep value, cordic_rep mask)
+                {
+                    return (value ^ mask)-mask;
+                }
+
+                // rotates (x, y) anticlockwise by atan(2^-iteration) if mask is 0 and clockwise if mask is -1
+                constexpr cordic_vector cordic_step(cordic_vector v, int iteration, cordic_rep mask)
+                {
+                    return cordic_vector{
+                            v.x-cordic_negate_if(v.y >> iteration, mask),
+                            v.y+cordic_negate_if(v.x >> iteration, mask),
+                            v.z-cordic_negate_if(cordic_angle(iteration), mask)};
+                }
+
+#if (__cplusplus>=201402L)
+                // rotates (x, y) by angle z
+                constexpr cordic_vector cordic_rotate(cordic_vector v, int iteration, int iterations)
+                {
+                    for (; iteration!=iterations; ++iteration) {
+                        v = cordic_step(v, iteration, (v.z<0) ? cordic_rep{-1} : cordic_rep{0});
+                    }
+                    return v;
+                }
+
+                // rotates (x, y) onto the x axis, accumulating the angle of rotation in z
+                constexpr cordic_vector cordic_vectoring(cordic_vector v, int iteration, int iterations)
+                {
+                    for (; iteration!=iterations; ++iteration) {
+                        v = cordic_step(v, iteration, (v.y<0) ? cordic_rep{0} : cordic_rep{-1});
+                    }
+                    return v;
+                }
+#else
+                // rotates (x, y) by angle z
+                constexpr cordic_vector cordic_rotate(cordic_vector v, int iteration, int iterations)
+                {
+                    return (iteration==iterations)
+                           ? v
+                           : cordic_rotate(
+                                   cordic_step(v, iteration, (v.z<0) ? cordic_rep{-1} : cordic_rep{0}),
+                                   iteration+1, iterations);
+                }
+
+                // rotates (x, y) onto the x axis, accumulating the angle of rotation in z
+                constexpr cordic_vector cordic_vectoring(cordic_vector v, int iteration, int iterations)
+                {
+                    return (iteration==iterations)
+                           ? v
+                           : cordic_vectoring(
+                                   cordic_step(v, iteration, (v.y<0) ? cordic_rep{0} : cordic_rep{-1}),
+                                   iteration+1, iterations);
+                }
+#endif
+
+                // range of cordic_rep values which Output can represent
+                template<class Output, _impl::enable_if_t<(Output::integer_digits>=2), int> dummy = 0>
+                constexpr cordic_rep cordic_max()
+                {
+                    return std::numeric_limits<cordic_rep>::max();
+                }
+
+                template<class Output, _impl::enable_if_t<(Output::integer_digits<2), int> dummy = 0>
+                constexpr cordic_rep cordic_max()
+                {
+                    return fixed_point<cordic_rep, -cordic_fractional_digits>{
+                            std::numeric_limits<Output>::max()}.data();
+                }
+
+                template<class Output, _impl::enable_if_t<(Output::integer_digits>=2), int> dummy = 0>
+                constexpr cordic_rep cordic_lowest()
+                {
+                    return is_signed<typename Output::rep>::value ? std::numeric_limits<cordic_rep>::lowest() : 0;
+                }
+
+                template<class Output, _impl::enable_if_t<(Output::integer_digits<2), int> dummy = 0>
+                constexpr cordic_rep cordic_lowest()
+                {
+                    return fixed_point<cordic_rep, -cordic_fractional_digits>{
+                            std::numeric_limits<Output>::lowest()}.data();
+                }
+
+                // half of an LSB of a value with the given number of fractional digits
+                constexpr cordic_rep cordic_half(int fractional_digits)
+                {
+                    return (fractional_digits<cordic_fractional_digits)
+                           ? cordic_rep{1} << _impl::min(cordic_fractional_digits-1-fractional_digits, 62)
+                           : cordic_rep{0};
+                }
+
+                // converts intermediate value to Output, rounding to nearest and confining to Output's range
+                template<class Output>
+                constexpr Output from_cordic(cordic_rep c)
+                {
+                    return (c>cordic_max<Output>())
+                           ? std::numeric_limits<Output>::max()
+                           : (c<cordic_lowest<Output>())
+                             ? std::numeric_limits<Output>::lowest()
+                             : Output{fixed_point<cordic_rep, -cordic_fractional_digits>::from_data(
+                                     (c<0)
+                                     ? c-cordic_half(Output::fractional_digits)
+                                     : c+cordic_half(Output::fractional_digits))};
+                }
+
+                // sin(z+quadrant*pi/2) given CORDIC output for z
+                template<class Output>
+                constexpr Output sin_quadrant(cordic_vector v, unsigned quadrant)
+                {
+                    return (quadrant==0)
+                           ? from_cordic<Output>(v.y)
+                           : (quadrant==1)
+                             ? from_cordic<Output>(v.x)
+                             : (quadrant==2)
+                               ? from_cordic<Output>(-v.y)
+                               : from_cordic<Output>(-v.x);
+                }
+
+                // sin(z+quadrant*pi/2) given -pi/2 < z < pi/2
+                template<class Output>
+                constexpr Output sin_reduced(cordic_rep z, unsigned quadrant)
+                {
+                    return sin_quadrant<Output>(
+                            cordic_rotate(
+                                    cordic_vector{cordic_constants<>::inverse_gain, 0, z},
+                                    0, cordic_iterations(Output::fractional_digits)),
+                            quadrant & 3u);
+                }
+
+                // pi/2 with the given number of fractional digits
+                constexpr cordic_rep half_pi(int fractional_digits)
+                {
+                    return (cordic_constants<>::half_pi+cordic_half(fractional_digits))
+                            >> (cordic_fractional_digits-fractional_digits);
+                }
+
+                // difference between pi/2 and half_pi(fractional_digits) in cordic_fractional_digits
+                constexpr cordic_rep half_pi_error(int fractional_digits)
+                {
+                    return cordic_constants<>::half_pi
+                           -half_pi(fractional_digits)*(cordic_rep{1} << (cordic_fractional_digits-fractional_digits));
+                }
+
+                // x-quotient*pi/2 in cordic_fractional_digits given x with FractionalDigits fractional digits;
+                // the error in the truncated pi/2 is applied at full precision to keep large arguments accurate
+                template<int FractionalDigits>
+                constexpr cordic_rep sin_remainder(cordic_rep x, cordic_rep quotient)
+                {
+                    return (x-quotient*half_pi(FractionalDigits))
+                           *(cordic_rep{1} << (cordic_fractional_digits-FractionalDigits))
+                           -quotient*half_pi_error(FractionalDigits);
+                }
+
+                // sin(x+quadrant*pi/2) given x with FractionalDigits fractional digits
+                template<class Output, int FractionalDigits>
+                constexpr Output sin_unreduced(cordic_rep x, unsigned quadrant)
+                {
+                    return (x<half_pi(FractionalDigits) && x>-half_pi(FractionalDigits))
+                           ? sin_reduced<Output>(
+                                   x*(cordic_rep{1} << (cordic_fractional_digits-FractionalDigits)),
+                                   quadrant)
+                           : sin_reduced<Output>(
+                                   sin_remainder<FractionalDigits>(x, x/half_pi(FractionalDigits)),
+                                   quadrant+static_cast<unsigned>(x/half_pi(FractionalDigits)));
+                }
+
+                // sin(x+quadrant*pi/2)
+                template<class Rep, int Exponent>
+                constexpr fixed_point<Rep, Exponent> sin(const fixed_point<Rep, Exponent>& x, unsigned quadrant)
+                {
+                    // as many fractional digits as possible while leaving room for x
+                    using intermediate = fixed_point<cordic_rep, -_impl::min(
+                            cordic_fractional_digits,
+                            digits<cordic_rep>::value-fixed_point<Rep, Exponent>::integer_digits)>;
+                    static_assert(intermediate::fractional_digits>0,
+                            "sin and cos need an argument with fewer than 63 integer digits, "
+                            "e.g. not fixed_point<int64_t, 0>, so that it can be reduced with 64-bit integers");
+
+                    return sin_unreduced<fixed_point<Rep, Exponent>, intermediate::fractional_digits>(
+                            intermediate{x}.data(), quadrant);
+                }
+
+                constexpr cordic_rep cordic_scale(cordic_rep value, int shift)
+                {
+                    return (shift>=0) ? value*(cordic_rep{1} << shift) : value >> -shift;
+                }
+
+                // shift which normalizes (x, y) to use all available bits
+                // while leaving room for them to grow during vectoring
+                constexpr int cordic_shift(cordic_rep x, cordic_rep y)
+                {
+                    return cordic_fractional_digits-1
+                           -used_bits(static_cast<std::uint64_t>(_impl::max(x, (y<0) ? ~y : y)));
+                }
+
+                // vectors (x*2^shift, y*2^shift) onto the x axis given x>=0
+                constexpr cordic_vector cordic_vectoring_scaled(cordic_rep x, cordic_rep y, int shift, int iterations)
+                {
+                    return cordic_vectoring(
+                            cordic_vector{cordic_scale(x, shift), cordic_scale(y, shift), 0},
+                            0, iterations);
+                }
+
+                // vectoring angle depends only on y/x so both are normalized to use all available bits
+                template<class Output>
+                constexpr Output atan_normalized(cordic_rep x, cordic_rep y)
+                {
+                    return from_cordic<Output>(cordic_vectoring_scaled(
+                            x, y, cordic_shift(x, y), cordic_iterations(Output::fractional_digits)).z);
+                }
+
+                template<class Rep, int Exponent>
+                constexpr fixed_point<Rep, Exponent> atan(const fixed_point<Rep, Exponent>& x)
+                {
+                    // ensure that x and 1 both fit
+                    using intermediate = fixed_point<cordic_rep, -_impl::min(
+                            digits<cordic_rep>::value-1,
+                            digits<cordic_rep>::value-_impl::max(0, fixed_point<Rep, Exponent>::integer_digits))>;
+                    static_assert(intermediate::fractional_digits>=0,
+                            "argument has too many integer digits");
+
+                    return atan_normalized<fixed_point<Rep, Exponent>>(intermediate{1}.data(), intermediate{x}.data());
+                }
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::sin, sg14::cos, sg14::atan
+
+    /// \brief calculates the sine of a \ref fixed_point value
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param x angle in radians
+    ///
+    /// \return sine of x; accurate to 1LSB for up to 48 fractional digits where x is less than 1000
+    /// in magnitude and to 2LSB for up to 56 fractional digits otherwise
+    ///
+    /// \note Uses integer CORDIC so the result is constexpr and does not depend on floating-point hardware.
+    /// \note Argument reduction is performed using 64-bit integers
+    /// so precision degrades slowly as the magnitude of x grows.
+    /// Intermediate values have 61 fractional digits, so beyond 56 fractional digits
+    /// the error grows to tens of LSB.
+    /// The argument must have fewer than 63 integer digits, which excludes fixed_point<int64_t, 0>
+    /// and other 64-bit types with no fractional digits; a static assertion fails otherwise.
+    ///
+    /// \sa cos, atan
+
     template<class Rep, int Exponent>
     constexpr fixed_point <Rep, Exponent>
-    cos(const fixed_point <Rep, Exponent>& x) noexcept
+    sin(const fixed_point <Rep, Exponent>& x) noexcept
     {
-        return _impl::fp::extras::crib<Rep, Exponent, std::cos>(x);
+        return _impl::fp::extras::sin(x, 0);
     }
 
+    /// \brief calculates the cosine of a \ref fixed_point value
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param x angle in radians
+    ///
+    /// \return cosine of x; accurate to the same bounds as \ref sin
+    ///
+    /// \note The argument must have fewer than 63 integer digits, as with \ref sin.
+    ///
+    /// \sa sin, atan
+
     template<class Rep, int Exponent>
     constexpr fixed_point <Rep, Exponent>
-    exp(const fixed_point <Rep, Exponent>& x) noexcept
+    cos(const fixed_point <Rep, Exponent>& x) noexcept
     {
-        return _impl::fp::extras::crib<Rep, Exponent, std::exp>(x);
+        return _impl::fp::extras::sin(x, 1);
     }
 
+    /// \brief calculates the arc tangent of a \ref fixed_point value
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param x input parameter
+    ///
+    /// \return arc tangent of x in radians; accurate to 1LSB for up to 54 fractional digits
+    /// and to 2LSB for up to 56 fractional digits
+    ///
+    /// \note Beyond 56 fractional digits, the error grows to tens of LSB, as with \ref sin.
+    ///
+    /// \sa sin, cos
+
     template<class Rep, int Exponent>
     constexpr fixed_point <Rep, Exponent>
-    pow(const fixed_point <Rep, Exponent>& x) noexcept
+    atan(const fixed_point <Rep, Exponent>& x) noexcept
     {
-        return _impl::fp::extras::crib<Rep, Exponent, std::pow>(x);
+        return _impl::fp::extras::atan(x);
     }
 
     ////////////////////////////////////////////////////////////////////////////////
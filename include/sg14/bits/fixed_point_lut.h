@@ -0,0 +1,265 @@
+
+//          Copyright John McFarlane 2015 - 2016.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief function approximation for `sg14::fixed_point` type using look-up tables generated at compile time;
+/// included from sg14/fixed_point - do not include directly!
+
+#if !defined(SG14_FIXED_POINT_LUT_H)
+#define SG14_FIXED_POINT_LUT_H 1
+
+#include "fixed_point_math.h"
+
+/// study group 14 of the C++ working group
+namespace sg14 {
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // interpolation tags and objects
+
+    // interpolate along a straight line between neighboring entries
+    static constexpr struct linear_interpolation_tag {
+    } linear_interpolation{};
+
+    // interpolate along a parabola through the ends and middle of each segment
+    static constexpr struct quadratic_interpolation_tag {
+    } quadratic_interpolation{};
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // implementation-specific definitions
+
+    namespace _impl {
+        namespace fp {
+            ////////////////////////////////////////////////////////////////////////////////
+            // compile-time list of table indices
+
+            template<int... Indices>
+            struct lut_indices {
+            };
+
+            template<class Lhs, class Rhs>
+            struct lut_concat;
+
+            template<int... LhsIndices, int... RhsIndices>
+            struct lut_concat<lut_indices<LhsIndices...>, lut_indices<RhsIndices...>> {
+                using type = lut_indices<LhsIndices..., (int(sizeof...(LhsIndices)) + RhsIndices)...>;
+            };
+
+            //lut_indices<0, 1, ..., Size-1>; halving keeps the depth of recursion logarithmic
+            template<int Size>
+            struct make_lut_indices
+                    : lut_concat<typename make_lut_indices<Size / 2>::type, typename make_lut_indices<Size - Size / 2>::type> {
+            };
+
+            template<>
+            struct make_lut_indices<0> {
+                using type = lut_indices<>;
+            };
+
+            template<>
+            struct make_lut_indices<1> {
+                using type = lut_indices<0>;
+            };
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // table generation
+
+            //Width of the representation of FixedPoint including the sign bit
+            template<class FixedPoint>
+            constexpr int lut_width() {
+                return digits<typename FixedPoint::rep>::value + is_signed<typename FixedPoint::rep>::value;
+            }
+
+            //Distance between the data of neighboring entries
+            template<class Input, int EntryBits>
+            constexpr std::uint64_t lut_spacing() {
+                return std::uint64_t{1} << (lut_width<Input>() - EntryBits);
+            }
+
+            //Input at which entry, index, is sampled
+            template<class Input, int EntryBits>
+            constexpr Input lut_knot(int index) {
+                using urep = typename std::make_unsigned<typename Input::rep>::type;
+                return Input::from_data(static_cast<typename Input::rep>(static_cast<urep>(
+                        static_cast<std::uint64_t>(static_cast<urep>(std::numeric_limits<Input>::lowest().data()))
+                                + static_cast<std::uint64_t>(index) * lut_spacing<Input, EntryBits>())));
+            }
+
+            //Converts the result of a function to the output of a table, rounding to nearest
+            template<class Output, class Result, _impl::enable_if_t<std::is_floating_point<Result>::value, int> dummy = 0>
+            constexpr typename Output::rep lut_entry(Result result) {
+                return rounding_conversion<Output>(static_cast<double>(result)).data();
+            }
+
+            template<class Output, class Result, _impl::enable_if_t<!std::is_floating_point<Result>::value, int> dummy = 0>
+            constexpr typename Output::rep lut_entry(Result result) {
+                return Output{result}.data();
+            }
+
+            //n / d, rounded to nearest
+            constexpr std::int64_t lut_divide(std::int64_t n, std::int64_t d) {
+                return (n < 0 ? n - d / 2 : n + d / 2) / d;
+            }
+
+            //Continues the line from the previous entry through the maximum input
+            //to the last entry, which lies one LSB beyond the range of Input
+            template<class Output, class Input, int EntryBits>
+            constexpr typename Output::rep lut_extrapolate(std::int64_t previous, std::int64_t last) {
+                return from_signed_data<Output>(last + lut_divide(last - previous,
+                        static_cast<std::int64_t>(lut_spacing<Input, EntryBits>() - 1))).data();
+            }
+
+            template<class Function, class Input, class Output, int EntryBits>
+            constexpr typename Output::rep lut_sample(int index) {
+                return index == (1 << EntryBits) ?
+                       lut_extrapolate<Output, Input, EntryBits>(
+                               lut_sample<Function, Input, Output, EntryBits>(index - 1),
+                               lut_entry<Output>(Function{}(std::numeric_limits<Input>::max())))
+                                                 :
+                       lut_entry<Output>(Function{}(lut_knot<Input, EntryBits>(index)));
+            }
+
+            template<class Function, class Input, class Output, int EntryBits, class Indices>
+            struct lut_table;
+
+            template<class Function, class Input, class Output, int EntryBits, int... Indices>
+            struct lut_table<Function, Input, Output, EntryBits, lut_indices<Indices...>> {
+                static constexpr typename Output::rep entries[sizeof...(Indices)] = {
+                        lut_sample<Function, Input, Output, EntryBits>(Indices)...
+                };
+            };
+
+            template<class Function, class Input, class Output, int EntryBits, int... Indices>
+            constexpr typename Output::rep
+                    lut_table<Function, Input, Output, EntryBits, lut_indices<Indices...>>::entries[sizeof...(Indices)];
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // interpolation
+
+            //Distance of x from the lowest value of Input in units of LSB;
+            //the high-order bits select a segment and the remainder locate x within it
+            template<class Input>
+            constexpr std::uint64_t lut_offset(Input x) {
+                using urep = typename std::make_unsigned<typename Input::rep>::type;
+                return static_cast<urep>(static_cast<urep>(x.data())
+                        - static_cast<urep>(std::numeric_limits<Input>::lowest().data()));
+            }
+
+            //v / 2^shift, rounded to nearest
+            constexpr std::int64_t lut_round(std::int64_t v, int shift) {
+                return (v + (std::int64_t{1} << (shift - 1))) >> shift;
+            }
+
+            //y0 + (y1 - y0) * t where t has Digits fractional digits
+            template<int Digits>
+            constexpr std::int64_t lut_linear(std::int64_t y0, std::int64_t y1, std::int64_t t) {
+                return y0 + lut_round((y1 - y0) * t, Digits);
+            }
+
+            //y0 + a * t + b * t^2 through y0, y1 and y2 at t=0, t=1/2 and t=1
+            template<int Digits>
+            constexpr std::int64_t lut_quadratic(std::int64_t y0, std::int64_t y1, std::int64_t y2, std::int64_t t) {
+                return y0 + lut_round(
+                        (4 * y1 - 3 * y0 - y2 + lut_round((2 * y2 + 2 * y0 - 4 * y1) * t, Digits)) * t, Digits);
+            }
+
+            template<class Interpolation>
+            struct lut_traits;
+
+            template<>
+            struct lut_traits<linear_interpolation_tag> {
+                //entries per segment, beyond the first
+                static constexpr int entry_shift = 0;
+
+                //bits of the interpolation product above those of the output
+                static constexpr int headroom = 1;
+
+                template<int Digits, class Rep>
+                static constexpr std::int64_t interpolate(Rep const* entries, std::int64_t t) {
+                    return lut_linear<Digits>(entries[0], entries[1], t);
+                }
+            };
+
+            template<>
+            struct lut_traits<quadratic_interpolation_tag> {
+                static constexpr int entry_shift = 1;
+                static constexpr int headroom = 4;
+
+                template<int Digits, class Rep>
+                static constexpr std::int64_t interpolate(Rep const* entries, std::int64_t t) {
+                    return lut_quadratic<Digits>(entries[0], entries[1], entries[2], t);
+                }
+            };
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::fixed_point_lut
+
+    /// \brief function approximation by look-up table and interpolation
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \tparam Function literal type whose `constexpr` function call operator takes an \a InputFP
+    /// and returns a floating-point or fixed-point value
+    /// \tparam InputFP fixed-point type of argument; the table spans its entire range
+    /// \tparam OutputFP fixed-point type of result
+    /// \tparam TableBits number of high-order bits of the input which select a segment of the table
+    /// \tparam Interpolation \ref linear_interpolation_tag or \ref quadratic_interpolation_tag
+    ///
+    /// The table samples \a Function at the ends of 2^TableBits segments of the input range
+    /// and, for quadratic interpolation, also at their midpoints.
+    /// Floating-point samples are rounded to nearest.
+    /// Because the table is generated at compile time and is never modified,
+    /// it can be shared between threads without synchronization.
+    ///
+    /// \note The end of the last segment lies one LSB beyond the range of \a InputFP,
+    /// so the last entry extends the line through the maximum input value instead.
+
+    template<class Function, class InputFP, class OutputFP, int TableBits, class Interpolation = linear_interpolation_tag>
+    class fixed_point_lut {
+        using _traits = _impl::fp::lut_traits<Interpolation>;
+        static constexpr int _entry_bits = TableBits + _traits::entry_shift;
+        static constexpr int _segment_bits = _impl::fp::lut_width<InputFP>() - TableBits;
+        static constexpr int _interpolation_digits = _impl::min(
+                _segment_bits, 63 - _impl::fp::lut_width<OutputFP>() - _traits::headroom);
+
+        static_assert(TableBits > 0 && _segment_bits > _traits::entry_shift,
+                "table must have more than one segment and fewer segments than input values");
+        static_assert(_impl::fp::lut_width<InputFP>() <= 64, "input type is too wide");
+        static_assert(_impl::fp::lut_width<OutputFP>() <= 32, "output type is too wide");
+
+        using _table = _impl::fp::lut_table<Function, InputFP, OutputFP, _entry_bits,
+                typename _impl::fp::make_lut_indices<(1 << _entry_bits) + 1>::type>;
+
+        static constexpr std::int64_t _interpolate(std::uint64_t offset) {
+            return _traits::template interpolate<_interpolation_digits>(
+                    _table::entries + ((offset >> _segment_bits) << _traits::entry_shift),
+                    static_cast<std::int64_t>((offset & ((std::uint64_t{1} << _segment_bits) - 1))
+                            >> (_segment_bits - _interpolation_digits)));
+        }
+
+    public:
+        /// alias to template parameter, \a InputFP
+        using input_type = InputFP;
+
+        /// alias to template parameter, \a OutputFP
+        using output_type = OutputFP;
+
+        /// number of entries in the table
+        static constexpr int size = (1 << _entry_bits) + 1;
+
+        /// returns the approximation of \a Function at \a x
+        static constexpr output_type evaluate(input_type x) {
+            return _impl::fp::from_signed_data<output_type>(_interpolate(_impl::fp::lut_offset(x)));
+        }
+
+        /// returns the approximation of \a Function at \a x
+        constexpr output_type operator()(input_type x) const {
+            return evaluate(x);
+        }
+    };
+}
+
+#endif	// SG14_FIXED_POINT_LUT_H
@@ -10,11 +10,23 @@
 #ifndef FIXED_POINT_MATH_H_
 #define FIXED_POINT_MATH_H_
 
-#include <sg14/fixed_point>
+#include "fixed_point_type.h"
+#include "fixed_point_make.h"
+#include "fixed_point_named.h"
+#include "fixed_point_common_type.h"
+#include "fixed_point_operators.h"
+#include "fixed_point_extras.h"
 
 /// study group 14 of the C++ working group
 namespace sg14 {
 
+    ////////////////////////////////////////////////////////////////////////////////
+    // division tags and objects
+
+    // divide by multiplying with a reciprocal refined by Newton-Raphson iterations
+    static constexpr struct fast_reciprocal_tag {
+    } fast_reciprocal{};
+
     ////////////////////////////////////////////////////////////////////////////////
     // implementation-specific definitions
 
@@ -35,53 +47,217 @@ namespace sg14 {
 
             static_assert(std::is_same<make_largest_ufraction<fixed_point<int32_t, -15>>, fixed_point<uint32_t, -32>>::value, "");
 
-            //TODO: template magic to get the coefficients automatically
-            //from the number of bits of precision
-            //Define the coefficients as constexpr,
-            //to make sure they're converted to fp
-            //at compile time
-            template<class CoeffType>
-            struct poly_coeffs {
-                static constexpr CoeffType a1 { rounding_conversion<CoeffType>(0.6931471860838825) };
-                static constexpr CoeffType a2 { rounding_conversion<CoeffType>(0.2402263846181129) };
-                static constexpr CoeffType a3 { rounding_conversion<CoeffType>(
-                        0.055505126858894846) };
-                static constexpr CoeffType a4 { rounding_conversion<CoeffType>(
-                        0.009614017013719252) };
-                static constexpr CoeffType a5 { rounding_conversion<CoeffType>(
-                        0.0013422634797558564) };
-                static constexpr CoeffType a6 { rounding_conversion<CoeffType>(
-                        0.00014352314226313836) };
-                static constexpr CoeffType a7 { rounding_conversion<CoeffType>(
-                        0.000021498763160402416) };
-            };
-
-            template<class CoeffType>
-            constexpr CoeffType poly_coeffs<CoeffType>::a1;
-            template<class CoeffType>
-            constexpr CoeffType poly_coeffs<CoeffType>::a2;
-            template<class CoeffType>
-            constexpr CoeffType poly_coeffs<CoeffType>::a3;
-            template<class CoeffType>
-            constexpr CoeffType poly_coeffs<CoeffType>::a4;
-            template<class CoeffType>
-            constexpr CoeffType poly_coeffs<CoeffType>::a5;
-            template<class CoeffType>
-            constexpr CoeffType poly_coeffs<CoeffType>::a6;
-            template<class CoeffType>
-            constexpr CoeffType poly_coeffs<CoeffType>::a7;
+            ////////////////////////////////////////////////////////////////////////////////
+            // polynomial evaluation
 
-            template<class Rep, int Exponent>
-            constexpr inline fixed_point<Rep, Exponent> evaluate_polynomial(
-                    fixed_point<Rep, Exponent> xf) {
+            //A compile-time list of coefficients of the polynomial, c0 + c1*x + c2*x^2 + ...,
+            //each of type Coefficient with FractionalDigits fractional digits
+            template<class Coefficient, int FractionalDigits, Coefficient ... Coefficients>
+            struct basic_polynomial {
+                static constexpr int fractional_digits = FractionalDigits;
+                static constexpr int size = sizeof...(Coefficients);
+                static constexpr Coefficient coefficients[sizeof...(Coefficients)] { Coefficients... };
+            };
+
+            template<class Coefficient, int FractionalDigits, Coefficient ... Coefficients>
+            constexpr int basic_polynomial<Coefficient, FractionalDigits, Coefficients...>::fractional_digits;
+            template<class Coefficient, int FractionalDigits, Coefficient ... Coefficients>
+            constexpr int basic_polynomial<Coefficient, FractionalDigits, Coefficients...>::size;
+            template<class Coefficient, int FractionalDigits, Coefficient ... Coefficients>
+            constexpr Coefficient basic_polynomial<Coefficient, FractionalDigits, Coefficients...>::coefficients[];
+
+            //Signed coefficients
+            template<int FractionalDigits, std::int64_t ... Coefficients>
+            using polynomial = basic_polynomial<std::int64_t, FractionalDigits, Coefficients...>;
+
+            //Non-negative coefficients, which keep all 64 bits for fractions in [0, 1)
+            template<int FractionalDigits, std::uint64_t ... Coefficients>
+            using unsigned_polynomial = basic_polynomial<std::uint64_t, FractionalDigits, Coefficients...>;
+
+            //Evaluation schemes:
+            //Horner's method, c0 + x*(c1 + x*(c2 + ...)), performs one multiply after another;
+            //Estrin's scheme, (c0 + c1*x) + x^2*(c2 + c3*x) + ..., evaluates the halves of the
+            //polynomial independently so that out-of-order processors can overlap the multiplies.
+            struct horner_scheme {
+            };
+
+            struct estrin_scheme {
+            };
+
+            //Coefficient, Index, of Polynomial rounded to the nearest FixedPoint
+            template<class Polynomial, int Index, class FixedPoint>
+            constexpr FixedPoint polynomial_coefficient() {
+                return FixedPoint::from_data(static_cast<typename FixedPoint::rep>(
+                        Polynomial::fractional_digits + FixedPoint::exponent <= 0 ?
+                        static_cast<std::uint64_t>(Polynomial::coefficients[Index])
+                                << -(Polynomial::fractional_digits + FixedPoint::exponent)
+                                                                                  :
+                        ((Polynomial::coefficients[Index]
+                                >> (Polynomial::fractional_digits + FixedPoint::exponent - 1)) + 1) >> 1));
+            }
+
+            //x^Power where Power is a power of two
+            template<int Power, class Rep, int Exponent, _impl::enable_if_t<(Power==1), int> dummy = 0>
+            constexpr fixed_point<Rep, Exponent> polynomial_power(fixed_point<Rep, Exponent> x) {
+                return x;
+            }
+
+            template<int Power, class Rep, int Exponent, _impl::enable_if_t<(Power>1), int> dummy = 0>
+            constexpr fixed_point<Rep, Exponent> polynomial_power(fixed_point<Rep, Exponent> x) {
+                using fp = fixed_point<Rep, Exponent>;
+                return fp{multiply(polynomial_power<Power / 2>(x), polynomial_power<Power / 2>(x))};
+            }
+
+            //Size of the lower part of a polynomial split by Estrin's scheme:
+            //the largest power of two which is less than size
+            constexpr int estrin_split(int size) {
+                return size <= 2 ? 1 : 2 * estrin_split((size + 1) / 2);
+            }
+
+            //Evaluates the Size terms from coefficient, First, onwards
+            template<class Polynomial, int First, int Size, class Rep, int Exponent, _impl::enable_if_t<(Size==1), int> dummy = 0>
+            constexpr fixed_point<Rep, Exponent> evaluate_polynomial(horner_scheme, fixed_point<Rep, Exponent>) {
+                return polynomial_coefficient<Polynomial, First, fixed_point<Rep, Exponent>>();
+            }
+
+            template<class Polynomial, int First, int Size, class Rep, int Exponent, _impl::enable_if_t<(Size>1), int> dummy = 0>
+            constexpr fixed_point<Rep, Exponent> evaluate_polynomial(horner_scheme scheme, fixed_point<Rep, Exponent> x) {
                 using fp = fixed_point<Rep, Exponent>;
+                return fp{polynomial_coefficient<Polynomial, First, fp>()
+                        + fp{multiply(x, evaluate_polynomial<Polynomial, First + 1, Size - 1>(scheme, x))}};
+            }
+
+            template<class Polynomial, int First, int Size, class Rep, int Exponent, _impl::enable_if_t<(Size==1), int> dummy = 0>
+            constexpr fixed_point<Rep, Exponent> evaluate_polynomial(estrin_scheme, fixed_point<Rep, Exponent>) {
+                return polynomial_coefficient<Polynomial, First, fixed_point<Rep, Exponent>>();
+            }
+
+            template<class Polynomial, int First, int Size, class Rep, int Exponent, _impl::enable_if_t<(Size>1), int> dummy = 0>
+            constexpr fixed_point<Rep, Exponent> evaluate_polynomial(estrin_scheme scheme, fixed_point<Rep, Exponent> x) {
+                using fp = fixed_point<Rep, Exponent>;
+                return fp{evaluate_polynomial<Polynomial, First, estrin_split(Size)>(scheme, x)
+                        + fp{multiply(polynomial_power<estrin_split(Size)>(x),
+                                evaluate_polynomial<Polynomial, First + estrin_split(Size), Size - estrin_split(Size)>(scheme, x))}};
+            }
 
-                //Use a polynomial min-max approximation to generate the exponential of
-                //the fractional part. Note that the constant 1 of the polynomial is added later,
-                //this gives us one more bit of precision here for free
-                using coeffs = poly_coeffs<fp>;
-                return fp{multiply(xf, (coeffs::a1+fp{multiply(xf, (coeffs::a2+fp{multiply(xf, (coeffs::a3+fp{multiply(xf, (coeffs::a4
-                        +fp{multiply(xf, (coeffs::a5+fp{multiply(xf, (coeffs::a6+fp{multiply(fp{coeffs::a7}, fp{xf})}))}))}))}))}))}))};
+            //Evaluates Polynomial at x using the given scheme.
+            //Coefficients and intermediate results are all of the same type as x.
+            template<class Polynomial, class Scheme = horner_scheme, class Rep, int Exponent>
+            constexpr fixed_point<Rep, Exponent> evaluate_polynomial(fixed_point<Rep, Exponent> x) {
+                return evaluate_polynomial<Polynomial, 0, Polynomial::size>(Scheme{}, x);
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // exponential polynomials
+
+            //Minimax approximations, a1*x + a2*x^2 + ... + aN*x^N, of 2^x - 1 for x in [0, 1),
+            //for each degree, N, from 2 to 12. The constant term of 2^x is left out and added later,
+            //which gives one more bit of precision for free. Each lists a1 to aN with 64 fractional
+            //digits: the polynomial, a1 + a2*x + ..., of (2^x - 1) / x, which is then multiplied by x.
+            //Its value approaches 1 as x approaches 1 but truncating each multiply keeps it below.
+            template<int Degree>
+            struct exp2_polynomial;
+
+            template<>
+            struct exp2_polynomial<2> : unsigned_polynomial<64,
+                    0xa94b6d941f5ad623, 0x55ef380d96c6f92f> {
+            };
+
+            template<>
+            struct exp2_polynomial<3> : unsigned_polynomial<64,
+                    0xb210039ffd003cc3, 0x39e682dc2829ca1d, 0x1401592f72d29e6e> {
+            };
+
+            template<>
+            struct exp2_polynomial<4> : unsigned_polynomial<64,
+                    0xb169a98f9971bc4f, 0x3dcf5f610ce4e43a, 0x0d4ca1952aa0b9bc, 0x037a0f87d60155df> {
+            };
+
+            template<>
+            struct exp2_polynomial<5> : unsigned_polynomial<64,
+                    0xb17270bc2250a78a, 0x3d7aa78679e8131b, 0x0e4b43683a45ae40, 0x024c144f814606ce,
+                    0x007b8e0adc24e865> {
+            };
+
+            template<>
+            struct exp2_polynomial<6> : unsigned_polynomial<64,
+                    0xb1721500ed141ec5, 0x3d7fb4e5c2aea391, 0x0e3419a86442ed2b, 0x027a7711fa5de813,
+                    0x00515cc915c2e632, 0x000e48897e576c83> {
+            };
+
+            template<>
+            struct exp2_polynomial<7> : unsigned_polynomial<64,
+                    0xb172180d22a810d3, 0x3d7f79e458fc5987, 0x0e35966121112e48, 0x02760cf76cd7e54a,
+                    0x0057fd7ff35af7b4, 0x000963012d7a1599, 0x00016a3491cac1fa> {
+            };
+
+            template<>
+            struct exp2_polynomial<8> : unsigned_polynomial<64,
+                    0xb17217f74d9fa5c0, 0x3d7f7c0fa075187a, 0x0e3583b5265c94f7, 0x02765934cf9ce734,
+                    0x005756f4764659ee, 0x000a2afec7db988f, 0x0000edb850e7416e, 0x00001f638b9d1abb> {
+            };
+
+            template<>
+            struct exp2_polynomial<9> : unsigned_polynomial<64,
+                    0xb17217f7d49fd377, 0x3d7f7bfe95644666, 0x0e35847184a8eed4, 0x0276554599fd7cf4,
+                    0x00576298b33e7837, 0x000a16eb1842d047, 0x000101ceb5100bae, 0x00001495081ae47a,
+                    0x0000026aeea38d4e> {
+            };
+
+            template<>
+            struct exp2_polynomial<10> : unsigned_polynomial<64,
+                    0xb17217f7d1c1cd54, 0x3d7f7bff08206e13, 0x0e35846b5712c0bc, 0x0276556f5d5bd402,
+                    0x005761f8f8c8bbef, 0x000a185c1541a184, 0x0000ffc19428fc86, 0x0000165754489231,
+                    0x0000019593f997ea, 0x0000002ae73994e5> {
+            };
+
+            template<>
+            struct exp2_polynomial<11> : unsigned_polynomial<64,
+                    0xb17217f7d1cfb59c, 0x3d7f7bff057d9bb9, 0x0e35846b835f2764, 0x0276556decb7def2,
+                    0x005761ffdb7bb2f9, 0x000a1847b85a4b54, 0x0000ffe8125ae73d, 0x00001628b9ccd86f,
+                    0x000001b88ad9e82a, 0x0000001c19a9e156, 0x00000002b41a2087> {
+            };
+
+            template<>
+            struct exp2_polynomial<12> : unsigned_polynomial<64,
+                    0xb17217f7d1cf78bd, 0x3d7f7bff058b5cb4, 0x0e35846b824a84dd, 0x0276556df78f3724,
+                    0x005761ff9c47c6d5, 0x000a1848a012df3c, 0x0000ffe5e5bdb28a, 0x0000162c330984d1,
+                    0x000001b4e26ed902, 0x0000001e8a1d8a85, 0x00000001c522fec0, 0x0000000027fa2ed9> {
+            };
+
+            template<class Dummy = void>
+            struct exp2_constants {
+                static constexpr int min_degree = 2;
+                static constexpr int max_degree = 12;
+
+                //Number of correct fractional digits of each polynomial
+                static constexpr int digits[max_degree - min_degree + 1] {
+                        8, 12, 17, 23, 28, 33, 39, 45, 51, 57, 63
+                };
+            };
+
+            template<class Dummy>
+            constexpr int exp2_constants<Dummy>::min_degree;
+            template<class Dummy>
+            constexpr int exp2_constants<Dummy>::max_degree;
+            template<class Dummy>
+            constexpr int exp2_constants<Dummy>::digits[];
+
+            //The lowest degree of polynomial which is more precise than the given number of fractional digits
+            constexpr int exp2_degree(int fractional_digits, int degree = exp2_constants<>::min_degree) {
+                return degree == exp2_constants<>::max_degree
+                        || exp2_constants<>::digits[degree - exp2_constants<>::min_degree] > fractional_digits ?
+                       degree
+                                                                                                           :
+                       exp2_degree(fractional_digits, degree + 1);
+            }
+
+            //Use a polynomial min-max approximation to generate the exponential of the fractional part.
+            //Its degree is the lowest which is accurate to the fractional digits of xf.
+            template<class Rep, int Exponent>
+            constexpr fixed_point<Rep, Exponent> exp2m1_polynomial(fixed_point<Rep, Exponent> xf) {
+                using fp = fixed_point<Rep, Exponent>;
+                return fp{multiply(xf, evaluate_polynomial<exp2_polynomial<exp2_degree(-Exponent)>, estrin_scheme>(xf))};
             }
 
             //Computes 2^x - 1 for a number x between 0 and 1, strictly less than 1
@@ -104,20 +280,719 @@ namespace sg14 {
                 using im = make_largest_ufraction<fixed_point<Rep, Exponent>>;
                 //The intermediate value type
 
-                return evaluate_polynomial(im{x}); //Important: convert the type once, to keep every multiply from costing a cast
+                return exp2m1_polynomial(im{x}); //Important: convert the type once, to keep every multiply from costing a cast
+            }
+
+            //n clamped to [-2^16, 2^16]; beyond that, 2^n is out of the range of any fixed_point
+            template<class Integer>
+            constexpr std::int64_t exp2_clamp(Integer n) {
+                return n >= Integer{0} ?
+                       static_cast<std::int64_t>(_impl::min(static_cast<std::uint64_t>(n), std::uint64_t{1} << 16))
+                                       :
+                       -static_cast<std::int64_t>(_impl::min(std::uint64_t{0} - static_cast<std::uint64_t>(n),
+                               std::uint64_t{1} << 16));
             }
 
+            //floor(x), shifted out of the underlying value and clamped so that 2^floor(x) saturates
+            //wherever the exact value would
             template<class Rep, int Exponent>
-            constexpr inline Rep floor(fixed_point<Rep, Exponent> x) {
-                return Rep { (x.data()) >> -Exponent };
+            constexpr std::int64_t floor_int(fixed_point<Rep, Exponent> x) {
+                return exp2_clamp(x.data() >> _impl::max(0, -Exponent))
+                        * (std::int64_t{1} << _impl::max(0, _impl::min(Exponent, 16)));
+            }
+
+            //Computes 2^n * (1 + fraction) where fraction is the result of exp2m1_0to1,
+            //saturating if the result is too big to be represented by Output
+            //and flushing to zero if it is less than half of the smallest positive value
+            template<class Output, class Fraction>
+            constexpr Output exp2_combine(std::int64_t n, Fraction fraction);
+
+            //Adds 2^n to the fraction, which is already shifted to the right place and rounded.
+            //If the fraction rounded up to one, the result is the next integer power of two.
+            template<class Output, class Fraction>
+            constexpr Output exp2_combine_rounded(std::int64_t n, typename Output::rep rounded) {
+                using rep = typename Output::rep;
+                return rounded == (rep{1} << (n - Output::exponent)) ?
+                       exp2_combine<Output>(n + 1, Fraction::from_data(0))
+                                                                     :
+                       Output::from_data(static_cast<rep>(rounded + (rep{1} << (n - Output::exponent))));
+            }
+
+            template<class Output, class Fraction>
+            constexpr Output exp2_combine(std::int64_t n, Fraction fraction) {
+                using rep = typename Output::rep;
+                return n >= Output::integer_digits ?
+                       std::numeric_limits<Output>::max()
+                                                   :
+                       n < Output::exponent - 1 ?
+                       Output::from_data(rep{0})
+                                                :
+                       n <= Output::exponent ?
+                       Output::from_data(rep{1})//return immediately if the shift would result in all bits being shifted out
+                                             :
+                       //Shift the fraction to the right place, rounding to nearest.
+                       //The constant term must be one, to make integer powers correct
+                       exp2_combine_rounded<Output, Fraction>(n, static_cast<rep>(
+                               ((fraction.data() >> (-Fraction::exponent + Output::exponent - n - 1)) + 1) >> 1));
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // 64-bit helpers shared by the exponential and logarithm functions
+
+            //The upper half of the 128-bit product of a and b
+#if defined(SG14_INT128_ENABLED)
+            constexpr std::uint64_t multiply_high(std::uint64_t a, std::uint64_t b) {
+                return static_cast<std::uint64_t>((SG14_UINT128{a} * b) >> 64);
+            }
+#else
+            constexpr std::uint64_t multiply_high(std::uint64_t a, std::uint64_t b) {
+                return (a >> 32) * (b >> 32)
+                        + (((a >> 32) * (b & 0xffffffffu)) >> 32)
+                        + (((a & 0xffffffffu) * (b >> 32)) >> 32)
+                        + (((((a & 0xffffffffu) * (b & 0xffffffffu)) >> 32)
+                                + (((a >> 32) * (b & 0xffffffffu)) & 0xffffffffu)
+                                + (((a & 0xffffffffu) * (b >> 32)) & 0xffffffffu)) >> 32);
+            }
+#endif
+
+            //Magnitude of a value as an unsigned 64-bit integer
+            template<class Integer>
+            constexpr std::uint64_t magnitude(Integer value) {
+                return value < Integer{0} ?
+                       std::uint64_t{0} - static_cast<std::uint64_t>(value)
+                                          :
+                       static_cast<std::uint64_t>(value);
+            }
+
+            //value * 2^shift where shift may be negative
+            constexpr std::uint64_t scale_magnitude(std::uint64_t value, int shift) {
+                return shift >= 0 ? value << shift : value >> -shift;
+            }
+
+            //Converts an unsigned raw value to Output, saturating if it is too large to represent
+            template<class Output>
+            constexpr Output from_unsigned_data(std::uint64_t raw) {
+                return raw > static_cast<std::uint64_t>(std::numeric_limits<Output>::max().data()) ?
+                       std::numeric_limits<Output>::max()
+                                                                                           :
+                       Output::from_data(static_cast<typename Output::rep>(raw));
+            }
+
+            //Converts raw to Output, saturating at either end of its range
+            template<class Output>
+            constexpr Output from_signed_data(std::int64_t raw) {
+                return raw >= 0 ?
+                       from_unsigned_data<Output>(static_cast<std::uint64_t>(raw))
+                                :
+                       raw < static_cast<std::int64_t>(std::numeric_limits<Output>::lowest().data()) ?
+                       std::numeric_limits<Output>::lowest()
+                                                                                                     :
+                       Output::from_data(static_cast<typename Output::rep>(raw));
+            }
+
+            //Irrational constants used to change the base of exponents and logarithms.
+            //Each uses all 64 bits with as many fractional digits as possible.
+            template<class Dummy = void>
+            struct log_constants {
+                static constexpr std::uint64_t log2_e { 0xb8aa3b295c17f0bc }; // fractional digits: 63
+                static constexpr std::uint64_t log2_10 { 0xd49a784bcd1b8afe }; // fractional digits: 62
+                static constexpr std::uint64_t ln_2 { 0xb17217f7d1cf79ac }; // fractional digits: 64
+            };
+
+            template<class Dummy>
+            constexpr std::uint64_t log_constants<Dummy>::log2_e;
+            template<class Dummy>
+            constexpr std::uint64_t log_constants<Dummy>::log2_10;
+            template<class Dummy>
+            constexpr std::uint64_t log_constants<Dummy>::ln_2;
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // exponential functions of bases other than 2
+
+            //Splits y = x * log2(base), held with FractionalDigits fractional digits, into
+            //integer and fractional parts and evaluates 2^y from them
+            template<class Output, int FractionalDigits, class Fraction = make_largest_ufraction<Output>>
+            constexpr Output exp2_split(std::int64_t y) {
+                return exp2_combine<Output>(
+                        y >> FractionalDigits,
+                        exp2m1_polynomial(Fraction{
+                                fixed_point<std::uint64_t, -FractionalDigits>::from_data(
+                                        static_cast<std::uint64_t>(y & ((std::int64_t{1} << FractionalDigits) - 1)))}));
+            }
+
+            //Calculates 2^(x * c) where c is a constant with ConstantIntegerDigits integer digits
+            //and 64-ConstantIntegerDigits fractional digits. The product is calculated at 64 bits
+            //so that the fractional part going into the polynomial is at least as precise as
+            //make_largest_ufraction.
+            template<int ConstantIntegerDigits, class Rep, int Exponent>
+            constexpr fixed_point<Rep, Exponent> exp2_scaled(fixed_point<Rep, Exponent> x, std::uint64_t c) {
+                using out_type = fixed_point<Rep, Exponent>;
+                static_assert(digits<Rep>::value <= 64, "exponential of this type is not supported");
+
+                //x is shifted so that the product has 62 significant digits
+                return exp2_split<out_type, 62 - out_type::integer_digits - ConstantIntegerDigits>(
+                        x < out_type{0} ?
+                        -static_cast<std::int64_t>(multiply_high(
+                                scale_magnitude(magnitude(x.data()), 62 - digits<Rep>::value), c))
+                                        :
+                        static_cast<std::int64_t>(multiply_high(
+                                scale_magnitude(magnitude(x.data()), 62 - digits<Rep>::value), c)));
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // logarithms
+
+            //Number of fractional digits in the intermediate logarithm;
+            //enough to round the result and to leave room for the integer part
+            constexpr int log2_fractional_digits(int exponent) {
+                return _impl::max(0, _impl::min(3 - exponent, 55));
+            }
+
+            //Calculates the next Digits digits of the fractional part of log2 of the mantissa, m,
+            //which is in the range [1, 2) with 63 fractional digits.
+            //Each squaring of m doubles its logarithm so the integer part of the result is the next digit.
+            constexpr std::int64_t log2_mantissa(std::uint64_t m, int digits, std::int64_t result) {
+                return digits == 0 ?
+                       result
+                                   :
+                       multiply_high(m, m) >= (std::uint64_t{1} << 63) ?
+                       log2_mantissa(multiply_high(m, m), digits - 1, result * 2 + 1)
+                                                                        :
+                       log2_mantissa(multiply_high(m, m) << 1, digits - 1, result * 2);
+            }
+
+            //log2 of a positive number, x * 2^exponent, with the given number of fractional digits
+            constexpr std::int64_t log2_raw(std::uint64_t x, int exponent, int fractional_digits) {
+                return (used_bits(x) - 1 + exponent) * (std::int64_t{1} << fractional_digits)
+                        + log2_mantissa(x << (64 - used_bits(x)), fractional_digits, 0);
+            }
+
+            //log2 of a positive number, x * 2^exponent,
+            //with log2_fractional_digits(exponent) fractional digits
+            constexpr std::int64_t log2_raw(std::uint64_t x, int exponent) {
+                return log2_raw(x, exponent, log2_fractional_digits(exponent));
+            }
+
+            //log2 of a positive fixed-point number
+            //with log2_fractional_digits(Exponent) fractional digits
+            template<class Rep, int Exponent>
+            constexpr std::int64_t log2_raw(fixed_point<Rep, Exponent> x) {
+                return log2_raw(fixed_point<std::uint64_t, Exponent>{x}.data(), Exponent);
+            }
+
+            //Multiplies a logarithm by a constant with 64 fractional digits, e.g. to change its base
+            constexpr std::int64_t log_scale(std::int64_t log, std::uint64_t c) {
+                return log < 0 ?
+                       -static_cast<std::int64_t>(multiply_high(magnitude(log), c))
+                               :
+                       static_cast<std::int64_t>(multiply_high(magnitude(log), c));
+            }
+
+            //Divides value by 2^shift, rounding to nearest, or multiplies by 2^-shift, saturating
+            constexpr std::int64_t shift_round(std::int64_t value, int shift) {
+                return shift > 0 ?
+                       (value + (std::int64_t{1} << (shift - 1))) >> shift
+                                 :
+                       value > (std::numeric_limits<std::int64_t>::max() >> -shift) ?
+                       std::numeric_limits<std::int64_t>::max()
+                                                                                    :
+                       value < (std::numeric_limits<std::int64_t>::min() >> -shift) ?
+                       std::numeric_limits<std::int64_t>::min()
+                                                                                    :
+                       value * (std::int64_t{1} << -shift);
+            }
+
+            //Rounds the result of log2_raw or log_scale to the nearest value of type, Output,
+            //saturating if it is out of range
+            template<class Output>
+            constexpr Output log_round(std::int64_t log) {
+                return from_signed_data<Output>(
+                        shift_round(log, log2_fractional_digits(Output::exponent) + Output::exponent));
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // powers
+
+            //base^N where N is positive, calculated by repeated squaring
+            template<int N, class Integer, _impl::enable_if_t<(N==1), int> dummy = 0>
+            constexpr Integer pow_integer(Integer base) {
+                return base;
+            }
+
+            template<int N, class Integer, _impl::enable_if_t<(N>1 && N%2==0), int> dummy = 0>
+            constexpr Integer pow_integer(Integer base) {
+                return pow_integer<N / 2>(static_cast<Integer>(base * base));
+            }
+
+            template<int N, class Integer, _impl::enable_if_t<(N>1 && N%2==1), int> dummy = 0>
+            constexpr Integer pow_integer(Integer base) {
+                return static_cast<Integer>(base * pow_integer<N - 1>(base));
+            }
+
+            //Converts a quotient or product to FixedPoint, saturating if it is out of range
+            template<class FixedPoint, class Quotient>
+            constexpr FixedPoint pow_saturate(Quotient q) {
+                return q > std::numeric_limits<FixedPoint>::max() ?
+                       std::numeric_limits<FixedPoint>::max()
+                                                                  :
+                       q < std::numeric_limits<FixedPoint>::lowest() ?
+                       std::numeric_limits<FixedPoint>::lowest()
+                                                                     :
+                       FixedPoint{q};
+            }
+
+            //x * y, rounded to the nearest value of the same type and saturating if it is out of range
+            template<class Rep, int Exponent, _impl::enable_if_t<(Exponent>=0), int> dummy = 0>
+            constexpr fixed_point<Rep, Exponent> multiply_round(fixed_point<Rep, Exponent> x, fixed_point<Rep, Exponent> y) {
+                return pow_saturate<fixed_point<Rep, Exponent>>(multiply(x, y));
+            }
+
+            template<class Rep, int Exponent, _impl::enable_if_t<(Exponent<0), int> dummy = 0>
+            constexpr fixed_point<Rep, Exponent> multiply_round(fixed_point<Rep, Exponent> x, fixed_point<Rep, Exponent> y) {
+                using product_rep = typename decltype(multiply(x, y))::rep;
+                return pow_saturate<fixed_point<Rep, Exponent>>(fixed_point<product_rep, Exponent>::from_data(
+                        (multiply(x, y).data() + (product_rep{1} << (-Exponent - 1))) >> -Exponent));
+            }
+
+            //x^n where n is positive, calculated by repeated squaring;
+            //the last square is not calculated so that it cannot overflow;
+            //a product which saturates stays saturated because every other factor has a magnitude above 1
+            template<class Rep, int Exponent>
+            constexpr fixed_point<Rep, Exponent> pow_squaring(fixed_point<Rep, Exponent> x, unsigned n) {
+                return n == 1u ?
+                       x
+                               :
+                       (n & 1u) ?
+                       multiply_round(x, pow_squaring(multiply_round(x, x), n >> 1))
+                                :
+                       pow_squaring(multiply_round(x, x), n >> 1);
+            }
+
+            //1, or the nearest value to it if FixedPoint cannot represent it
+            template<class FixedPoint>
+            constexpr FixedPoint pow_one() {
+                return FixedPoint::integer_digits > 0 ? FixedPoint{1} : std::numeric_limits<FixedPoint>::max();
+            }
+
+            //1/p, saturating if the result is too large to represent
+            template<class Rep, int Exponent>
+            constexpr fixed_point<Rep, Exponent> pow_reciprocal(fixed_point<Rep, Exponent> p) {
+                using fp = fixed_point<Rep, Exponent>;
+                return (p == fp(0) || fp::integer_digits <= 0) ?
+                       (p < fp(0) ? std::numeric_limits<fp>::lowest() : std::numeric_limits<fp>::max())
+                                                               :
+                       pow_saturate<fp>(fp{1} / p);
+            }
+
+            //Whether the value, magnitude * 2^exponent, is an integer
+            constexpr bool pow_is_integer(std::uint64_t magnitude, int exponent) {
+                return exponent >= 0 || (exponent <= -64 ?
+                                         magnitude == 0
+                                                          :
+                                         (magnitude & ((std::uint64_t{1} << -exponent) - 1)) == 0);
+            }
+
+            //Whether the value, magnitude * 2^exponent, is an odd integer
+            constexpr bool pow_is_odd(std::uint64_t magnitude, int exponent) {
+                return exponent <= 0 && exponent > -64 && pow_is_integer(magnitude, exponent)
+                        && ((magnitude >> -exponent) & 1) != 0;
+            }
+
+            //Number of integer digits of the magnitude of log2(x) for any x of type, X
+            template<class X>
+            constexpr int pow_log2_integer_digits() {
+                return used_bits(static_cast<std::uint64_t>(_impl::max(-X::exponent, X::integer_digits) + 1));
+            }
+
+            //Number of fractional digits of log2(x) which keep the error in y * log2(x) below
+            //the precision needed to round 2^(y * log2(x)) to type, X
+            template<class X, class Y>
+            constexpr int pow_log2_fractional_digits() {
+                return _impl::min(
+                        _impl::max(0, -X::exponent) + _impl::max(0, X::integer_digits) + 2 + _impl::max(0, Y::integer_digits),
+                        63 - pow_log2_integer_digits<X>());
+            }
+
+            //Number of fractional digits of y * log2(x) as calculated by pow_log2_product
+            template<class X, class Y>
+            constexpr int pow_product_fractional_digits() {
+                return 62 - _impl::max(0, Y::integer_digits) - pow_log2_integer_digits<X>();
+            }
+
+            //Magnitude of y * log2(x) given log2(x) with pow_log2_fractional_digits fractional digits;
+            //both are shifted so that their product has pow_product_fractional_digits fractional digits
+            template<class X, class Y>
+            constexpr std::uint64_t pow_log2_product(std::int64_t log, std::uint64_t y_magnitude) {
+                return multiply_high(
+                        scale_magnitude(y_magnitude, 63 - _impl::max(0, Y::integer_digits) + Y::exponent),
+                        magnitude(log) << (63 - pow_log2_integer_digits<X>() - pow_log2_fractional_digits<X, Y>()));
+            }
+
+            //Unlike the argument of exp2, y * log2(x) has more fractional digits than X so the
+            //fractional part is evaluated at twice the digits of X where that fits in 32 bits
+            template<class X>
+            using pow_fraction = fixed_point<
+                    set_digits_t<std::uint32_t, _impl::min(2 * digits<unsigned_rep<X>>::value,
+                            _impl::max(digits<unsigned_rep<X>>::value, 32))>,
+                    -_impl::min(2 * digits<unsigned_rep<X>>::value, _impl::max(digits<unsigned_rep<X>>::value, 32))>;
+
+            //2^(y * log) where log has pow_log2_fractional_digits fractional digits
+            template<class X, class Y>
+            constexpr X pow_exp2(std::int64_t log, std::uint64_t y_magnitude, bool y_negative) {
+                return exp2_split<X, pow_product_fractional_digits<X, Y>(), pow_fraction<X>>(
+                        (log < 0) != y_negative ?
+                        -static_cast<std::int64_t>(pow_log2_product<X, Y>(log, y_magnitude))
+                                                :
+                        static_cast<std::int64_t>(pow_log2_product<X, Y>(log, y_magnitude)));
+            }
+
+            //|x|^y for x and y other than zero, negated if negate is true
+            template<class X, class Y>
+            constexpr X pow_magnitude(std::uint64_t x_magnitude, std::uint64_t y_magnitude, bool y_negative, bool negate) {
+                return negate ?
+                       X{-pow_exp2<X, Y>(log2_raw(x_magnitude, X::exponent, pow_log2_fractional_digits<X, Y>()),
+                               y_magnitude, y_negative)}
+                              :
+                       pow_exp2<X, Y>(log2_raw(x_magnitude, X::exponent, pow_log2_fractional_digits<X, Y>()),
+                               y_magnitude, y_negative);
+            }
+
+            template<class X, class Y>
+            constexpr X pow_real(std::uint64_t x_magnitude, bool x_negative, std::uint64_t y_magnitude, bool y_negative) {
+                return y_magnitude == 0 ?
+                       pow_one<X>()
+                                        :
+                       x_magnitude == 0 ?
+                       (y_negative ? std::numeric_limits<X>::max() : X{0})
+                                        :
+                       pow_magnitude<X, Y>(x_magnitude, y_magnitude, y_negative,
+                               x_negative && pow_is_odd(y_magnitude, Y::exponent));
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // reciprocal square root
+
+            //Estimates of 1/sqrt(m) for m in [1, 4), indexed by m with 4 fractional digits, less 16.
+            //Each is the value at the middle of its interval with 8 fractional digits, less 128.
+            template<class Dummy = void>
+            struct rsqrt_constants {
+                static constexpr unsigned char seeds[48] {
+                        124, 117, 110, 104,  98,  93,  88,  83,  79,  75,  71,  67,  64,  61,  57,  54,
+                         52,  49,  46,  44,  41,  39,  37,  35,  33,  31,  29,  27,  26,  24,  22,  21,
+                         19,  18,  16,  15,  13,  12,  11,   9,   8,   7,   6,   5,   4,   3,   2,   1
+                };
+            };
+
+            template<class Dummy>
+            constexpr unsigned char rsqrt_constants<Dummy>::seeds[48];
+
+            //Number of Newton-Raphson iterations which refine a seed to the given number of digits;
+            //each iteration roughly doubles the number of correct digits of the seed, which has 6
+            constexpr int rsqrt_iterations(int digits) {
+                return digits <= 10 ? 1 : digits <= 20 ? 2 : digits <= 40 ? 3 : 4;
+            }
+
+            //Estimates 1/sqrt(m) with 63 fractional digits where m is in [1, 4) with 62 fractional digits
+            constexpr std::uint64_t rsqrt_seed(std::uint64_t m) {
+                return static_cast<std::uint64_t>(rsqrt_constants<>::seeds[(m >> 58) - 16] + 128u) << 55;
+            }
+
+            //Refines estimate, y, of 1/sqrt(m) by calculating y * (3 - m * y^2) / 2
+            //using multiplication only; m and y have 62 and 63 fractional digits respectively
+            constexpr std::uint64_t rsqrt_refine(std::uint64_t m, std::uint64_t y, int iterations) {
+                return iterations == 0 ?
+                       y
+                                       :
+                       rsqrt_refine(m, multiply_high(y, (std::uint64_t{3} << 60)
+                               - multiply_high(m, multiply_high(y, y))) << 3, iterations - 1);
+            }
+
+            //Rounds y / 2^shift, where y has 63 fractional digits, to the nearest value of type, Output
+            template<class Output>
+            constexpr Output rsqrt_round(std::uint64_t y, int shift) {
+                return shift > 64 ?
+                       Output::from_data(0)
+                                  :
+                       shift > 0 ?
+                       from_unsigned_data<Output>(((y >> (shift - 1)) + 1) >> 1)
+                                 :
+                       shift == 0 ? from_unsigned_data<Output>(y) : std::numeric_limits<Output>::max();
+            }
+
+            //1/sqrt(m * 2^(2 * half_exponent)) where m is in [1, 4) with 62 fractional digits
+            template<class Output>
+            constexpr Output rsqrt_normalized(std::uint64_t m, int half_exponent) {
+                return rsqrt_round<Output>(
+                        rsqrt_refine(m, rsqrt_seed(m), rsqrt_iterations(digits<typename Output::rep>::value + 1)),
+                        63 + half_exponent + Output::exponent);
+            }
+
+            //1/sqrt(x * 2^exponent) where shift moves the leading bit of x to bit 62 or 63
+            //such that the exponent of the shifted value, 62 - shift + exponent, is even
+            template<class Output>
+            constexpr Output rsqrt_shifted(std::uint64_t x, int exponent, int shift) {
+                return rsqrt_normalized<Output>(scale_magnitude(x, shift), (62 - shift + exponent) / 2);
+            }
+
+            //1/sqrt(x * 2^exponent) where x is positive
+            template<class Output>
+            constexpr Output rsqrt_raw(std::uint64_t x, int exponent) {
+                return rsqrt_shifted<Output>(x, exponent, 64 - used_bits(x) - ((exponent - used_bits(x)) & 1));
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // division by reciprocal
+
+            //Estimates of 2^19 / d for the 9 leading bits, d, of a normalized divisor, indexed by d less 256;
+            //each is (2^19 - 3 * 2^8) / d so that it never exceeds the reciprocal
+            template<class Dummy = void>
+            struct reciprocal_constants {
+                static constexpr std::uint16_t seeds[256] {
+                        0x7fd, 0x7f5, 0x7ed, 0x7e5, 0x7dd, 0x7d5, 0x7ce, 0x7c6, 0x7bf, 0x7b7, 0x7b0, 0x7a8, 0x7a1, 0x79a, 0x792, 0x78b,
+                        0x784, 0x77d, 0x776, 0x76f, 0x768, 0x761, 0x75b, 0x754, 0x74d, 0x747, 0x740, 0x739, 0x733, 0x72c, 0x726, 0x720,
+                        0x719, 0x713, 0x70d, 0x707, 0x700, 0x6fa, 0x6f4, 0x6ee, 0x6e8, 0x6e2, 0x6dc, 0x6d6, 0x6d1, 0x6cb, 0x6c5, 0x6bf,
+                        0x6ba, 0x6b4, 0x6ae, 0x6a9, 0x6a3, 0x69e, 0x698, 0x693, 0x68d, 0x688, 0x683, 0x67d, 0x678, 0x673, 0x66e, 0x669,
+                        0x664, 0x65e, 0x659, 0x654, 0x64f, 0x64a, 0x645, 0x640, 0x63c, 0x637, 0x632, 0x62d, 0x628, 0x624, 0x61f, 0x61a,
+                        0x616, 0x611, 0x60c, 0x608, 0x603, 0x5ff, 0x5fa, 0x5f6, 0x5f1, 0x5ed, 0x5e9, 0x5e4, 0x5e0, 0x5dc, 0x5d7, 0x5d3,
+                        0x5cf, 0x5cb, 0x5c6, 0x5c2, 0x5be, 0x5ba, 0x5b6, 0x5b2, 0x5ae, 0x5aa, 0x5a6, 0x5a2, 0x59e, 0x59a, 0x596, 0x592,
+                        0x58e, 0x58a, 0x586, 0x583, 0x57f, 0x57b, 0x577, 0x574, 0x570, 0x56c, 0x568, 0x565, 0x561, 0x55e, 0x55a, 0x556,
+                        0x553, 0x54f, 0x54c, 0x548, 0x545, 0x541, 0x53e, 0x53a, 0x537, 0x534, 0x530, 0x52d, 0x52a, 0x526, 0x523, 0x520,
+                        0x51c, 0x519, 0x516, 0x513, 0x50f, 0x50c, 0x509, 0x506, 0x503, 0x500, 0x4fc, 0x4f9, 0x4f6, 0x4f3, 0x4f0, 0x4ed,
+                        0x4ea, 0x4e7, 0x4e4, 0x4e1, 0x4de, 0x4db, 0x4d8, 0x4d5, 0x4d2, 0x4cf, 0x4cc, 0x4ca, 0x4c7, 0x4c4, 0x4c1, 0x4be,
+                        0x4bb, 0x4b9, 0x4b6, 0x4b3, 0x4b0, 0x4ad, 0x4ab, 0x4a8, 0x4a5, 0x4a3, 0x4a0, 0x49d, 0x49b, 0x498, 0x495, 0x493,
+                        0x490, 0x48d, 0x48b, 0x488, 0x486, 0x483, 0x481, 0x47e, 0x47c, 0x479, 0x477, 0x474, 0x472, 0x46f, 0x46d, 0x46a,
+                        0x468, 0x465, 0x463, 0x461, 0x45e, 0x45c, 0x459, 0x457, 0x455, 0x452, 0x450, 0x44e, 0x44b, 0x449, 0x447, 0x444,
+                        0x442, 0x440, 0x43e, 0x43b, 0x439, 0x437, 0x435, 0x432, 0x430, 0x42e, 0x42c, 0x42a, 0x428, 0x425, 0x423, 0x421,
+                        0x41f, 0x41d, 0x41b, 0x419, 0x417, 0x414, 0x412, 0x410, 0x40e, 0x40c, 0x40a, 0x408, 0x406, 0x404, 0x402, 0x400
+                };
+            };
+
+            template<class Dummy>
+            constexpr std::uint16_t reciprocal_constants<Dummy>::seeds[256];
+
+            //The following refine the seed, v0, of the reciprocal of normalized divisor, d, to
+            //v = (2^128 - 1) / d - 2^64, following Moller and Granlund, Improved division by invariant integers;
+            //each Newton-Raphson iteration roughly doubles the number of correct digits
+            //and the last adjusts the estimate to be exact
+
+            //v0 with 21 digits where d40 is the 40 leading bits of d, rounded up
+            constexpr std::uint64_t reciprocal_v1(std::uint64_t v0, std::uint64_t d40) {
+                return (v0 << 11) - ((v0 * v0 * d40) >> 40) - 1;
+            }
+
+            //v1 with 34 digits
+            constexpr std::uint64_t reciprocal_v2(std::uint64_t v1, std::uint64_t d40) {
+                return (v1 << 13) + ((v1 * ((std::uint64_t{1} << 60) - v1 * d40)) >> 47);
+            }
+
+            //v2 with 64 digits, less one at most; e is 2^96 - v2 * d / 2, modulo 2^64
+            constexpr std::uint64_t reciprocal_v3(std::uint64_t v2, std::uint64_t d) {
+                return (v2 << 31) + (multiply_high(v2, ((v2 >> 1) & (std::uint64_t{0} - (d & 1)))
+                        - v2 * ((d >> 1) + (d & 1))) >> 1);
+            }
+
+            //v3 less the high word of (2^64 + v3 + 1) * d
+            constexpr std::uint64_t reciprocal_v4(std::uint64_t v3, std::uint64_t d) {
+                return v3 - (multiply_high(v3, d) + d + (v3 * d + d < d));
+            }
+
+            //(2^128 - 1) / d - 2^64 where the most significant bit of d is set
+            constexpr std::uint64_t reciprocal_word(std::uint64_t d) {
+                return reciprocal_v4(reciprocal_v3(reciprocal_v2(reciprocal_v1(
+                        reciprocal_constants<>::seeds[(d >> 55) - 256], (d >> 24) + 1), (d >> 24) + 1), d), d);
+            }
+
+            //Adds one to estimate, q, of the quotient if remainder, r, is not less than divisor, d
+            constexpr std::uint64_t reciprocal_adjust(std::uint64_t q, std::uint64_t r, std::uint64_t d) {
+                return r >= d ? q + 1 : q;
             }
 
+            //Corrects estimate, q1, whose fraction is q0, by the remainder of its product with d
+            constexpr std::uint64_t reciprocal_correct(std::uint64_t q1, std::uint64_t q0, std::uint64_t u0, std::uint64_t d) {
+                return u0 - q1 * d > q0 ?
+                       reciprocal_adjust(q1 - 1, u0 - q1 * d + d, d)
+                                        :
+                       reciprocal_adjust(q1, u0 - q1 * d, d);
+            }
+
+            //(u1 * 2^64 + u0) / d where u1 < d, the most significant bit of d is set and v is its reciprocal_word
+            constexpr std::uint64_t reciprocal_divide(std::uint64_t u1, std::uint64_t u0, std::uint64_t d, std::uint64_t v) {
+                return reciprocal_correct(multiply_high(v, u1) + u1 + (v * u1 + u0 < u0) + 1, v * u1 + u0, u0, d);
+            }
+
+            //(n * 2^shift) / d where the most significant bit of d is set;
+            //the maximum value if the quotient does not fit in 64 bits
+            constexpr std::uint64_t reciprocal_shifted(std::uint64_t n, int shift, std::uint64_t d, std::uint64_t v) {
+                return shift <= -64 ?
+                       0
+                                    :
+                       shift <= 0 ?
+                       reciprocal_divide(0, n >> -shift, d, v)
+                                  :
+                       shift < 64 ?
+                       ((n >> (64 - shift)) >= d ? ~std::uint64_t{0} : reciprocal_divide(n >> (64 - shift), n << shift, d, v))
+                                  :
+                       shift < 128 ?
+                       (n > ((d - 1) >> (shift - 64)) ? ~std::uint64_t{0} : reciprocal_divide(n << (shift - 64), 0, d, v))
+                                   :
+                       (n ? ~std::uint64_t{0} : 0);
+            }
+
+            //(n * 2^shift) / d; the maximum value if d is zero
+            constexpr std::uint64_t reciprocal_quotient(std::uint64_t n, int shift, std::uint64_t d) {
+                return d ?
+                       reciprocal_shifted(n, shift + 64 - used_bits(d), d << (64 - used_bits(d)),
+                               reciprocal_word(d << (64 - used_bits(d))))
+                         :
+                       ~std::uint64_t{0};
+            }
+
+            //Output with magnitude, q, in LSB and the given sign, saturating if it is too large to represent
+            template<class Output>
+            constexpr Output reciprocal_result(std::uint64_t q, bool negative) {
+                return !negative ?
+                       from_unsigned_data<Output>(q)
+                                 :
+                       q > magnitude(std::numeric_limits<Output>::lowest().data()) ?
+                       std::numeric_limits<Output>::lowest()
+                                                                                   :
+                       Output::from_data(static_cast<typename Output::rep>(static_cast<std::int64_t>(0 - q)));
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // functions of two coordinates
+
+            //Shift which normalizes magnitudes, a and b, like extras::cordic_shift
+            constexpr int cordic_magnitude_shift(std::uint64_t a, std::uint64_t b) {
+                return extras::cordic_fractional_digits - 1 - used_bits(_impl::max(a, b));
+            }
+
+            //Vectors (a*2^shift, b*2^shift), negating the y coordinate if b_negative, onto the x axis;
+            //a and b are magnitudes, which can be too large for cordic_rep until they are scaled
+            constexpr extras::cordic_vector cordic_vectoring_magnitudes(
+                    std::uint64_t a, std::uint64_t b, bool b_negative, int shift, int iterations) {
+                return extras::cordic_vectoring(extras::cordic_vector{
+                        static_cast<extras::cordic_rep>(scale_magnitude(a, shift)),
+                        b_negative ?
+                        -static_cast<extras::cordic_rep>(scale_magnitude(b, shift))
+                                   :
+                        static_cast<extras::cordic_rep>(scale_magnitude(b, shift)),
+                        0}, 0, iterations);
+            }
+
+            //atan2(y, x) where (x, y) is not (0, 0);
+            //if x is negative, (-x, -y) is vectored instead and the result rotated by pi;
+            //they are negated as magnitudes so that the lowest value can be negated
+            template<class Output>
+            constexpr Output atan2_cordic(extras::cordic_rep x, extras::cordic_rep y) {
+                return x < 0 ?
+                       extras::from_cordic<Output>(
+                               cordic_vectoring_magnitudes(magnitude(x), magnitude(y), y > 0,
+                                       cordic_magnitude_shift(magnitude(x), magnitude(y)),
+                                       extras::cordic_iterations(Output::fractional_digits)).z
+                               + (y < 0 ? -2 : 2) * extras::cordic_constants<>::half_pi)
+                             :
+                       extras::atan_normalized<Output>(x, y);
+            }
+
+            //Number of bits by which values of Rep are shifted right to fit in cordic_rep
+            template<class Rep>
+            constexpr int cordic_input_shift() {
+                return _impl::max(0, digits<Rep>::value - digits<extras::cordic_rep>::value);
+            }
+
+            template<class Rep>
+            constexpr extras::cordic_rep to_cordic(Rep data) {
+                return static_cast<extras::cordic_rep>(data >> cordic_input_shift<Rep>());
+            }
+
+            //Number of CORDIC iterations which find the magnitude of a vector to the given number of digits;
+            //the error in the magnitude is proportional to the square of the angle which remains
+            constexpr int hypot_iterations(int digits) {
+                return digits / 2 + 2;
+            }
+
+            //Rounds the magnitude, scaled by 2^shift, to the nearest value of type, Output
+            template<class Output>
+            constexpr Output hypot_round(std::uint64_t scaled, int shift) {
+                return shift > 0 ?
+                       from_unsigned_data<Output>(((scaled >> (shift - 1)) + 1) >> 1)
+                                 :
+                       scaled > (std::numeric_limits<std::uint64_t>::max() >> -shift) ?
+                       std::numeric_limits<Output>::max()
+                                                                                      :
+                       from_unsigned_data<Output>(scaled << -shift);
+            }
+
+            //hypot(a, b) where a and b are not negative and are scaled by 2^shift during vectoring
+            //having been shifted right by input_shift bits to fit in cordic_rep;
+            //the resulting x coordinate is the magnitude multiplied by the CORDIC gain
+            template<class Output>
+            constexpr Output hypot_scaled(std::uint64_t a, std::uint64_t b, int shift, int input_shift) {
+                return hypot_round<Output>(multiply_high(
+                        static_cast<std::uint64_t>(cordic_vectoring_magnitudes(
+                                a, b, false, shift, hypot_iterations(digits<typename Output::rep>::value)).x),
+                        static_cast<std::uint64_t>(extras::cordic_constants<>::inverse_gain) << 3), shift - input_shift);
+            }
+
+            //hypot(a, b) where a and b are shifted right by input_shift bits
+            template<class Output>
+            constexpr Output hypot_cordic(std::uint64_t a, std::uint64_t b, int input_shift) {
+                return hypot_scaled<Output>(a, b, cordic_magnitude_shift(a, b), input_shift);
+            }
+
+            ////////////////////////////////////////////////////////////////////////////////
+            // activation functions
+
+            //e^-|x| and the logistic function of |x| are held in 32-bit fractions
+            using activation_fraction = fixed_point<std::uint32_t, -32>;
+
+            //Calculates e^(-|x| * 2^Shift) like exp2_scaled but with activation_fraction as output;
+            //the result is saturated below one and is zero once |x| * 2^Shift * log2(e) exceeds 33,
+            //as exp2_split keeps the whole integer part of the product
+            template<int Shift, class Rep, int Exponent>
+            constexpr std::uint64_t activation_exp(fixed_point<Rep, Exponent> x) {
+                static_assert(digits<Rep>::value <= 64, "activation function of this type is not supported");
+                return exp2_split<activation_fraction, 61 - fixed_point<Rep, Exponent>::integer_digits - Shift>(
+                        -static_cast<std::int64_t>(multiply_high(
+                                scale_magnitude(magnitude(x.data()), 62 - digits<Rep>::value),
+                                log_constants<>::log2_e))).data();
+            }
+
+            //1 / (1 + e) where e = e^-|x|, i.e. the logistic function of |x|, with 32 fractional digits
+            constexpr std::int64_t logistic_raw(std::uint64_t e) {
+                return static_cast<std::int64_t>(~std::uint64_t{0} / ((std::uint64_t{1} << 32) + e));
+            }
+
+            //Converts raw with Digits fractional digits to the data of Output, rounding to nearest;
+            //raw must be less than 2^62 in magnitude
+            template<class Output, int Digits>
+            constexpr std::int64_t activation_round(std::int64_t raw) {
+                return shift_round(raw, _impl::min(Digits + Output::exponent, 63));
+            }
+
+            //Fractional digits of log2(1 + e^-|x|) as calculated for softplus(x)
+            template<class Output>
+            constexpr int softplus_log2_digits() {
+                return _impl::min(_impl::max(0, -Output::exponent) + 2, 60);
+            }
+
+            //ln(1 + e) with 62 fractional digits where e = e^-|x|
+            template<class Output>
+            constexpr std::int64_t softplus_log_raw(std::uint64_t e) {
+                return static_cast<std::int64_t>(multiply_high(
+                        static_cast<std::uint64_t>(log2_raw((std::uint64_t{1} << 32) + e, -32, softplus_log2_digits<Output>()))
+                                << (63 - softplus_log2_digits<Output>()),
+                        log_constants<>::ln_2) >> 1);
+            }
         }
     }
 
     /// Calculates exp2(x), i.e. 2^x
     /// \headerfile sg14/fixed_point
     ///
+    /// The degree of the polynomial which approximates the fractional part is chosen
+    /// from the width of the underlying representation, e.g. 3 for 8 bits and 7 for 32 bits.
     /// Accurate to 1LSB for up to 32 bit underlying representation.
     ///
     /// \tparam x the input value as a fixed_point
@@ -128,21 +1003,393 @@ namespace sg14 {
         using namespace _impl::fp;
 
         using out_type = fixed_point<Rep, Exponent>;
-        // The input type
-        using im = make_largest_ufraction<out_type>;
 
         //Calculate the final result by shifting the fractional part around.
         //Remember to add the 1 which is left out to get 1 bit more resolution
-        return out_type::from_data(
-                floor(x) <= Exponent ?
-                    typename im::rep{1}//return immediately if the shift would result in all bits being shifted out
-                                     :
-                    	//Do the shifts manually. Once the branch with shift operators is merged, could use those
-                    (exp2m1_0to1<Rep, Exponent>(static_cast<out_type>(x - floor(x))).data()//Calculate the exponent of the fractional part
-                    >> (-im::exponent + Exponent - floor(x)))//shift it to the right place
-                    + (Rep { 1 } << (floor(x) - Exponent))); //The constant term must be one, to make integer powers correct
+        return exp2_combine<out_type>(
+                floor_int(x),
+                exp2m1_0to1<Rep, Exponent>(static_cast<out_type>(x - floor(x))));//Calculate the exponent of the fractional part
     }
 
+    /// Calculates exp(x), i.e. e^x
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Evaluates exp2(x * log2(e)) using integer arithmetic only.
+    /// Accurate to 2LSB for up to 32 bit underlying representation, as the rounding of
+    /// the scaled exponent adds to that of exp2.
+    ///
+    /// \tparam x the input value as a fixed_point
+    ///
+    /// \return the result of the exponential, in the same representation as x
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> exp(fixed_point<Rep, Exponent> x) {
+        using namespace _impl::fp;
+        return exp2_scaled<1>(x, log_constants<>::log2_e);
+    }
+
+    /// Calculates exp10(x), i.e. 10^x
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Evaluates exp2(x * log2(10)) using integer arithmetic only.
+    /// Accurate to 2LSB for up to 32 bit underlying representation, as with \ref exp.
+    ///
+    /// \tparam x the input value as a fixed_point
+    ///
+    /// \return the result of the exponential, in the same representation as x
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> exp10(fixed_point<Rep, Exponent> x) {
+        using namespace _impl::fp;
+        return exp2_scaled<2>(x, log_constants<>::log2_10);
+    }
+
+    /// Calculates log2(x), i.e. the base-2 logarithm of x
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Digits of the result are found by repeatedly squaring the mantissa of x using integer arithmetic only.
+    /// Rounded to the nearest representable value for results with up to 54 fractional digits.
+    /// Results which are out of range saturate.
+    ///
+    /// \tparam x the input value as a fixed_point; must be positive
+    ///
+    /// \return the result of the logarithm, in the same representation as x;
+    /// lowest() if x is not positive and exceptions are disabled
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> log2(fixed_point<Rep, Exponent> x) {
+        using namespace _impl::fp;
+        return
+#if defined(SG14_EXCEPTIONS_ENABLED)
+                (x <= fixed_point<Rep, Exponent>(0))
+                ? throw std::invalid_argument("cannot calculate logarithm of non-positive value") :
+#endif
+                (x <= fixed_point<Rep, Exponent>(0))
+                ? std::numeric_limits<fixed_point<Rep, Exponent>>::lowest()
+                : log_round<fixed_point<Rep, Exponent>>(log2_raw(x));
+    }
+
+    /// Calculates log(x), i.e. the natural logarithm of x
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Evaluates log2(x) / log2(e) using integer arithmetic only.
+    /// Accurate to 1LSB for results with up to 54 fractional digits.
+    /// Results which are out of range saturate, as with \ref log2.
+    ///
+    /// \tparam x the input value as a fixed_point; must be positive
+    ///
+    /// \return the result of the logarithm, in the same representation as x;
+    /// lowest() if x is not positive and exceptions are disabled
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> log(fixed_point<Rep, Exponent> x) {
+        using namespace _impl::fp;
+        return
+#if defined(SG14_EXCEPTIONS_ENABLED)
+                (x <= fixed_point<Rep, Exponent>(0))
+                ? throw std::invalid_argument("cannot calculate logarithm of non-positive value") :
+#endif
+                (x <= fixed_point<Rep, Exponent>(0))
+                ? std::numeric_limits<fixed_point<Rep, Exponent>>::lowest()
+                : log_round<fixed_point<Rep, Exponent>>(log_scale(log2_raw(x), log_constants<>::ln_2));
+    }
+
+    /// Calculates pow(x, N), i.e. x^N, for a positive integer, N, known at compile time
+    /// \headerfile sg14/fixed_point
+    ///
+    /// The result type is wide enough to hold the exact result, as with \ref multiply.
+    /// It is calculated by repeated squaring.
+    ///
+    /// \tparam N the exponent
+    /// \param x the base
+    ///
+    /// \return x^N, exactly
+    template<int N, class Rep, int Exponent>
+    constexpr fixed_point<set_digits_t<Rep, digits<Rep>::value * N>, Exponent * N> pow(fixed_point<Rep, Exponent> x) {
+        using namespace _impl::fp;
+        static_assert(N > 0, "exponent must be positive");
+        using result_rep = set_digits_t<Rep, digits<Rep>::value * N>;
+        return fixed_point<result_rep, Exponent * N>::from_data(
+                pow_integer<N>(static_cast<result_rep>(x.data())));
+    }
+
+    /// Calculates pow(x, n), i.e. x^n, for an integer, n
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Calculated by repeated squaring. Each product is calculated at twice the width of Rep
+    /// and rounded to the nearest value of the type of x. For negative exponents, the
+    /// reciprocal of x is taken first, so no intermediate value is larger than the result.
+    /// Where 1/x or x^n cannot be represented, the result saturates.
+    ///
+    /// \param x the base
+    /// \param n the exponent
+    ///
+    /// \return x^n, in the same representation as x
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> pow(fixed_point<Rep, Exponent> x, int n) {
+        using namespace _impl::fp;
+        return n == 0 ?
+               pow_one<fixed_point<Rep, Exponent>>()
+                      :
+               n < 0 ?
+               pow_squaring(pow_reciprocal(x), static_cast<unsigned>(-(n + 1)) + 1u)
+                     :
+               pow_squaring(x, static_cast<unsigned>(n));
+    }
+
+    /// Calculates pow(x, y), i.e. x^y
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Evaluates exp2(y * log2(x)) using integer arithmetic only. The logarithm is calculated
+    /// with enough fractional digits for the product to be accurate to the precision of x.
+    /// For up to 32 bit underlying representation, the error is within 2LSB.
+    ///
+    /// \param x the base; if negative, y must be an integer
+    /// \param y the exponent
+    ///
+    /// \return x^y, in the same representation as x
+    template<class Rep, int Exponent, class RepY, int ExponentY>
+    constexpr fixed_point<Rep, Exponent> pow(fixed_point<Rep, Exponent> x, fixed_point<RepY, ExponentY> y) {
+        using namespace _impl::fp;
+        static_assert(digits<Rep>::value <= 64 && digits<RepY>::value <= 64, "power of this type is not supported");
+        return
+#if defined(SG14_EXCEPTIONS_ENABLED)
+                (x < fixed_point<Rep, Exponent>(0) && !pow_is_integer(magnitude(y.data()), ExponentY))
+                ? throw std::invalid_argument("cannot raise negative value to non-integer power") :
+#endif
+                pow_real<fixed_point<Rep, Exponent>, fixed_point<RepY, ExponentY>>(
+                        magnitude(x.data()), x < fixed_point<Rep, Exponent>(0),
+                        magnitude(y.data()), y < fixed_point<RepY, ExponentY>(0));
+    }
+
+    /// Calculates rsqrt(x), i.e. 1/sqrt(x)
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Looks up an estimate in a small table and refines it with Newton-Raphson iterations
+    /// which use multiplication only; fewer iterations are performed for narrower outputs.
+    /// Rounded to the nearest representable value for results with up to 56 significant digits.
+    /// Results which are too large to represent, including the result of zero, saturate.
+    ///
+    /// The result can be expressed in a format other than that of the input, e.g. so that
+    /// a vector is normalized with a single multiply:
+    /// \code
+    /// auto unit_x = x * rsqrt<fixed_point<int32_t, -30>>(magnitude_squared(x, y, z));
+    /// \endcode
+    ///
+    /// \tparam Output the fixed_point type of the result
+    /// \param x the input value as a fixed_point; must not be negative
+    ///
+    /// \return the reciprocal square root of x as Output
+    template<class Output, class Rep, int Exponent>
+    constexpr Output rsqrt(fixed_point<Rep, Exponent> x) {
+        using namespace _impl::fp;
+        static_assert(digits<Rep>::value <= 64 && digits<typename Output::rep>::value <= 64,
+                "reciprocal square root of this type is not supported");
+        return
+#if defined(SG14_EXCEPTIONS_ENABLED)
+                (x < fixed_point<Rep, Exponent>(0))
+                ? throw std::invalid_argument("cannot calculate reciprocal square root of negative value") :
+#endif
+                (x == fixed_point<Rep, Exponent>(0))
+                ? std::numeric_limits<Output>::max()
+                : rsqrt_raw<Output>(fixed_point<std::uint64_t, Exponent>{x}.data(), Exponent);
+    }
+
+    /// Calculates rsqrt(x), i.e. 1/sqrt(x), in the same representation as x
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param x the input value as a fixed_point; must not be negative
+    ///
+    /// \return the reciprocal square root of x
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> rsqrt(fixed_point<Rep, Exponent> x) {
+        return rsqrt<fixed_point<Rep, Exponent>>(x);
+    }
+
+    /// \brief calculates the quotient of two \ref fixed_point values using a reciprocal of the divisor
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Rather than dividing a widened dividend, as `operator/` does, this finds a 64-bit reciprocal of the divisor
+    /// with a look-up table and Newton-Raphson iterations and multiplies the dividend by it.
+    /// Only 64-bit multiplication is needed so there is no call to a 128-bit division routine.
+    /// Whether this is faster than `operator/` depends on the cost of hardware division on the target.
+    /// \code
+    /// auto q = divide<fixed_point<int32_t, -16>>(fast_reciprocal, fixed_point<int16_t, -8>{3}, fixed_point<int16_t, -8>{4});
+    /// \endcode
+    ///
+    /// \tparam Output the fixed_point type of the result
+    /// \param lhs, rhs dividend and divisor
+    ///
+    /// \return quotient: lhs / rhs as Output, rounded toward zero, exactly;
+    /// saturated if it cannot be represented by Output or if rhs is zero
+    ///
+    /// \sa divide
+    template<class Output, class LhsRep, int LhsExponent, class RhsRep, int RhsExponent>
+    constexpr Output divide(fast_reciprocal_tag, fixed_point<LhsRep, LhsExponent> lhs, fixed_point<RhsRep, RhsExponent> rhs) {
+        using namespace _impl::fp;
+        static_assert(digits<LhsRep>::value <= 64 && digits<RhsRep>::value <= 64
+                && digits<typename Output::rep>::value <= 64, "division of this type is not supported");
+        return reciprocal_result<Output>(
+                reciprocal_quotient(magnitude(lhs.data()), LhsExponent - RhsExponent - Output::exponent, magnitude(rhs.data())),
+                (lhs.data() < LhsRep{0}) != (rhs.data() < RhsRep{0}));
+    }
+
+    /// \brief calculates the quotient of two \ref fixed_point values of the same type using a reciprocal of the divisor
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param lhs, rhs dividend and divisor
+    ///
+    /// \return quotient: lhs / rhs in the same representation, rounded toward zero;
+    /// saturated if it cannot be represented or if rhs is zero
+    ///
+    /// \sa divide
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> divide(fast_reciprocal_tag, fixed_point<Rep, Exponent> lhs, fixed_point<Rep, Exponent> rhs) {
+        return divide<fixed_point<Rep, Exponent>>(fast_reciprocal, lhs, rhs);
+    }
+
+    /// Calculates atan2(y, x), i.e. the angle of the vector, (x, y)
+    /// \headerfile sg14/fixed_point
+    ///
+    /// The vector is normalized by its leading bits and its angle found by CORDIC vectoring
+    /// using integers no wider than 64 bits, so the operands can use their full range.
+    ///
+    /// \param y the y coordinate of the vector
+    /// \param x the x coordinate of the vector
+    ///
+    /// \return angle of the vector in radians in the range, [-pi, pi], accurate to 1LSB;
+    /// zero if both coordinates are zero
+    ///
+    /// \sa atan, hypot
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> atan2(fixed_point<Rep, Exponent> y, fixed_point<Rep, Exponent> x) {
+        using namespace _impl::fp;
+        return (x == fixed_point<Rep, Exponent>(0) && y == fixed_point<Rep, Exponent>(0))
+               ? fixed_point<Rep, Exponent>(0)
+               : atan2_cordic<fixed_point<Rep, Exponent>>(to_cordic(x.data()), to_cordic(y.data()));
+    }
+
+    /// Calculates the logistic function of x, i.e. 1 / (1 + e^-x)
+    /// \headerfile sg14/fixed_point
+    ///
+    /// e^-|x| and its logistic function are calculated as 32-bit fractions using integer arithmetic only;
+    /// the result for negative x is the complement of that for |x|.
+    /// Accurate to 1LSB for up to 24 fractional digits and to 2LSB for up to 31.
+    ///
+    /// \return the logistic function of x, rounded to the nearest representable value;
+    /// saturated if the type cannot represent values close to 1
+    ///
+    /// \sa tanh, softplus
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> sigmoid(fixed_point<Rep, Exponent> x) {
+        using namespace _impl::fp;
+        return from_signed_data<fixed_point<Rep, Exponent>>(activation_round<fixed_point<Rep, Exponent>, 32>(
+                x < fixed_point<Rep, Exponent>(0) ?
+                (std::int64_t{1} << 32) - logistic_raw(activation_exp<0>(x))
+                                                  :
+                logistic_raw(activation_exp<0>(x))));
+    }
+
+    /// Calculates tanh(x), the hyperbolic tangent of x
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Calculated from the logistic function of 2|x| as 2 / (1 + e^(-2|x|)) - 1.
+    /// Accurate to 1LSB for up to 24 fractional digits and to 2LSB for up to 31.
+    ///
+    /// \return hyperbolic tangent of x, rounded to the nearest representable value;
+    /// saturated if the type cannot represent values close to 1
+    ///
+    /// \sa sigmoid
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> tanh(fixed_point<Rep, Exponent> x) {
+        using namespace _impl::fp;
+        return from_signed_data<fixed_point<Rep, Exponent>>(activation_round<fixed_point<Rep, Exponent>, 32>(
+                x < fixed_point<Rep, Exponent>(0) ?
+                (std::int64_t{1} << 32) - 2 * logistic_raw(activation_exp<1>(x))
+                                                  :
+                2 * logistic_raw(activation_exp<1>(x)) - (std::int64_t{1} << 32)));
+    }
+
+    /// Calculates softplus(x), i.e. ln(1 + e^x)
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Calculated as max(x, 0) + ln(1 + e^-|x|) so that no intermediate value overflows.
+    /// Accurate to 1LSB for up to 24 fractional digits and to 2LSB for up to 31.
+    ///
+    /// \return softplus of x, rounded to the nearest representable value;
+    /// saturated if it is too large to represent
+    ///
+    /// \sa sigmoid, log
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> softplus(fixed_point<Rep, Exponent> x) {
+        using namespace _impl::fp;
+        return from_signed_data<fixed_point<Rep, Exponent>>(
+                (x > fixed_point<Rep, Exponent>(0) ? static_cast<std::int64_t>(x.data()) : std::int64_t{0})
+                        + activation_round<fixed_point<Rep, Exponent>, 62>(
+                                softplus_log_raw<fixed_point<Rep, Exponent>>(activation_exp<0>(x))));
+    }
+
+    /// Calculates the logistic function of each of the \a size elements of \a input
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param input the first element of an array of inputs
+    /// \param output the first element of an array of \a size results; may be equal to \a input
+    /// \param size the number of elements
+    ///
+    /// \sa sigmoid(fixed_point<Rep, Exponent>)
+    template<class Rep, int Exponent>
+    void sigmoid(fixed_point<Rep, Exponent> const* input, fixed_point<Rep, Exponent>* output, std::size_t size) {
+        for (auto last = input + size; input != last; ++input, ++output) {
+            *output = sigmoid(*input);
+        }
+    }
+
+    /// Calculates the hyperbolic tangent of each of the \a size elements of \a input
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param input the first element of an array of inputs
+    /// \param output the first element of an array of \a size results; may be equal to \a input
+    /// \param size the number of elements
+    ///
+    /// \sa tanh(fixed_point<Rep, Exponent>)
+    template<class Rep, int Exponent>
+    void tanh(fixed_point<Rep, Exponent> const* input, fixed_point<Rep, Exponent>* output, std::size_t size) {
+        for (auto last = input + size; input != last; ++input, ++output) {
+            *output = tanh(*input);
+        }
+    }
+
+    /// Calculates softplus of each of the \a size elements of \a input
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param input the first element of an array of inputs
+    /// \param output the first element of an array of \a size results; may be equal to \a input
+    /// \param size the number of elements
+    ///
+    /// \sa softplus(fixed_point<Rep, Exponent>)
+    template<class Rep, int Exponent>
+    void softplus(fixed_point<Rep, Exponent> const* input, fixed_point<Rep, Exponent>* output, std::size_t size) {
+        for (auto last = input + size; input != last; ++input, ++output) {
+            *output = softplus(*input);
+        }
+    }
+
+    /// Calculates hypot(x, y), i.e. sqrt(x*x + y*y)
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Squares are not calculated so no wider type is needed. Instead, the vector is normalized
+    /// by its leading bits and rotated onto the x axis by CORDIC vectoring.
+    /// Accurate to 1LSB for results with up to 56 significant digits.
+    ///
+    /// \param x the x coordinate of the vector
+    /// \param y the y coordinate of the vector
+    ///
+    /// \return magnitude of the vector, rounded to the nearest representable value;
+    /// saturated if it is too large to represent
+    ///
+    /// \sa atan2, sqrt
+    template<class Rep, int Exponent>
+    constexpr fixed_point<Rep, Exponent> hypot(fixed_point<Rep, Exponent> x, fixed_point<Rep, Exponent> y) {
+        using namespace _impl::fp;
+        return hypot_cordic<fixed_point<Rep, Exponent>>(
+                magnitude(to_cordic(x.data())), magnitude(to_cordic(y.data())), cordic_input_shift<Rep>());
+    }
 }
 
 #endif /* FIXED_POINT_MATH_H_ */
@@ -13,6 +13,7 @@
 #include "common.h"
 
 #include "fixed_point_arithmetic.h"
+#include "fixed_point_rounding.h"
 
 /// study group 14 of the C++ working group
 namespace sg14 {
@@ -112,6 +113,238 @@ namespace sg14 {
     {
         return _impl::fp::operate<_impl::fp::division_named_function_tag>(lhs, rhs, _impl::divide_tag);
     }
+
+    namespace _impl {
+        namespace fp {
+            // the signed integer in which a*b+c is calculated without loss
+            // and the exponent to which the product and the addend are aligned
+            template<class A, class B, class C>
+            struct fma_params {
+                static constexpr int product_exponent = A::exponent+B::exponent;
+                static constexpr int exponent = _impl::min(product_exponent, C::exponent);
+
+                static constexpr int product_digits = digits<typename A::rep>::value+digits<typename B::rep>::value
+                        +(product_exponent-exponent);
+                static constexpr int addend_digits = digits<typename C::rep>::value+(C::exponent-exponent);
+
+                // one more digit for the carry of the addition
+                using rep = set_digits_t<std::int64_t, _impl::max(product_digits, addend_digits)+1>;
+            };
+
+            template<class A, class B, class C>
+            using fma_rep = typename fma_params<A, B, C>::rep;
+
+            template<class A, class B, class C>
+            constexpr fma_rep<A, B, C> fma_sum(A const& a, B const& b, C const& c)
+            {
+                using rep = fma_rep<A, B, C>;
+                using params = fma_params<A, B, C>;
+                return static_cast<rep>(a.data())*static_cast<rep>(b.data())
+                        *(rep{1} << (params::product_exponent-params::exponent))
+                        +static_cast<rep>(c.data())*(rep{1} << (C::exponent-params::exponent));
+            }
+        }
+    }
+
+    /// \brief calculates a*b+c, rounding only once
+    /// \headerfile sg14/fixed_point
+    ///
+    /// The product is calculated at full width and the addend is aligned to it without loss.
+    /// Their sum is then converted to the result with a single shift.
+    /// \code
+    /// auto acc = fma<fixed_point<int32_t, -16>>(nearest_rounding, coefficient, sample, acc);
+    /// \endcode
+    ///
+    /// \tparam Output the fixed_point type of the result
+    /// \param rounding \ref floor_rounding, \ref nearest_rounding, \ref nearest_even_rounding,
+    /// \ref toward_zero_rounding or, with sg14/auxiliary/stochastic_rounding.h, \ref stochastic_rounding
+    /// \param a, b factors
+    /// \param c addend
+    ///
+    /// \return a*b+c as Output; results beyond the range of Output wrap like those of conversion
+    ///
+    /// \sa multiply, add
+
+    template<class Output, class RoundingTag, class ARep, int AExponent, class BRep, int BExponent, class CRep, int CExponent,
+            _impl::enable_if_t<is_rounding_tag<RoundingTag>::value, int> Dummy = 0>
+    constexpr Output fma(
+            RoundingTag rounding,
+            fixed_point<ARep, AExponent> const& a,
+            fixed_point<BRep, BExponent> const& b,
+            fixed_point<CRep, CExponent> const& c)
+    {
+        using params = _impl::fp::fma_params<fixed_point<ARep, AExponent>, fixed_point<BRep, BExponent>,
+                fixed_point<CRep, CExponent>>;
+        using _impl::fp::rounding_shift;
+        return Output::from_data(static_cast<typename Output::rep>(
+                rounding_shift<Output::exponent-params::exponent>(rounding, _impl::fp::fma_sum(a, b, c))));
+    }
+
+    /// \brief calculates a*b+c in the type of the addend, c, rounding only once
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param rounding \ref floor_rounding, \ref nearest_rounding, \ref nearest_even_rounding,
+    /// \ref toward_zero_rounding or, with sg14/auxiliary/stochastic_rounding.h, \ref stochastic_rounding
+    /// \param a, b factors
+    /// \param c addend
+    ///
+    /// \return a*b+c in the same representation as c
+    ///
+    /// \sa multiply, add
+
+    template<class RoundingTag, class ARep, int AExponent, class BRep, int BExponent, class CRep, int CExponent,
+            _impl::enable_if_t<is_rounding_tag<RoundingTag>::value, int> Dummy = 0>
+    constexpr fixed_point<CRep, CExponent> fma(
+            RoundingTag rounding,
+            fixed_point<ARep, AExponent> const& a,
+            fixed_point<BRep, BExponent> const& b,
+            fixed_point<CRep, CExponent> const& c)
+    {
+        return fma<fixed_point<CRep, CExponent>>(rounding, a, b, c);
+    }
+
+    /// \brief calculates a*b+c in the type of the addend, c, rounding toward zero only once
+    /// so that the result matches conversion of the exact sum, e.g. `static_cast<C>(a*b+c)`
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param a, b factors
+    /// \param c addend
+    ///
+    /// \return a*b+c in the same representation as c
+    ///
+    /// \sa multiply, add
+
+    template<class ARep, int AExponent, class BRep, int BExponent, class CRep, int CExponent>
+    constexpr fixed_point<CRep, CExponent> fma(
+            fixed_point<ARep, AExponent> const& a,
+            fixed_point<BRep, BExponent> const& b,
+            fixed_point<CRep, CExponent> const& c)
+    {
+        return fma<fixed_point<CRep, CExponent>>(toward_zero_rounding, a, b, c);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::convert with rounding
+
+    namespace _impl {
+        namespace fp {
+            // no digits are lost
+            template<class Output, class RoundingTag, class Rep, int Exponent,
+                    enable_if_t<(Output::exponent<=Exponent), int> dummy = 0>
+            constexpr Output rounding_convert(RoundingTag, fixed_point<Rep, Exponent> const& input)
+            {
+                return static_cast<Output>(input);
+            }
+
+            template<class Output, class RoundingTag, class Rep, int Exponent,
+                    enable_if_t<(Output::exponent>Exponent), int> dummy = 0>
+            constexpr Output rounding_convert(RoundingTag rounding, fixed_point<Rep, Exponent> const& input)
+            {
+                return Output::from_data(static_cast<typename Output::rep>(
+                        rounding_shift<Output::exponent-Exponent>(rounding, input.data())));
+            }
+        }
+    }
+
+    /// \brief converts a \ref fixed_point value to another \ref fixed_point type,
+    /// rounding any digits which are lost as specified
+    /// \headerfile sg14/fixed_point
+    ///
+    /// Conversion by construction rounds toward zero, as \ref toward_zero_rounding does;
+    /// this can also round to nearest so that repeated rescaling does not accumulate bias.
+    /// \code
+    /// auto y = convert<fixed_point<int16_t, -15>>(nearest_even_rounding, acc);
+    /// \endcode
+    ///
+    /// \tparam Output the fixed_point type of the result
+    /// \param rounding \ref floor_rounding, \ref nearest_rounding, \ref nearest_even_rounding,
+    /// \ref toward_zero_rounding or, with sg14/auxiliary/stochastic_rounding.h, \ref stochastic_rounding
+    /// \param input the value to convert
+    ///
+    /// \return input as Output; results beyond the range of Output wrap like those of conversion
+    ///
+    /// \sa multiply, fma
+
+    template<class Output, class RoundingTag, class Rep, int Exponent,
+            _impl::enable_if_t<is_rounding_tag<RoundingTag>::value, int> Dummy = 0>
+    constexpr Output convert(RoundingTag rounding, fixed_point<Rep, Exponent> const& input)
+    {
+        return _impl::fp::rounding_convert<Output>(rounding, input);
+    }
+
+    /// \brief converts a floating-point value to a \ref fixed_point type,
+    /// rounding any digits which are lost as specified
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \tparam Output the fixed_point type of the result
+    /// \param rounding \ref floor_rounding, \ref nearest_rounding, \ref nearest_even_rounding,
+    /// \ref toward_zero_rounding or, with sg14/auxiliary/stochastic_rounding.h, \ref stochastic_rounding
+    /// \param input the value to convert
+    ///
+    /// \return input as Output; the behavior is undefined if it is beyond the range of Output
+
+    template<class Output, class RoundingTag, class S,
+            _impl::enable_if_t<is_rounding_tag<RoundingTag>::value && std::is_floating_point<S>::value, int> Dummy = 0>
+    constexpr Output convert(RoundingTag rounding, S input)
+    {
+        using _impl::fp::rounding_integer;
+        return Output::from_data(rounding_integer<typename Output::rep>(
+                rounding, input*_impl::fp::type::pow2<S, -Output::exponent>()));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::multiply with rounding
+
+    /// \brief calculates the product of two \ref fixed_point factors,
+    /// rounding any digits which are lost as specified
+    /// \headerfile sg14/fixed_point
+    ///
+    /// The product is calculated at full width and then converted to the result with a single shift.
+    /// With \ref toward_zero_rounding, the result equals `static_cast<Output>(lhs*rhs)`.
+    /// \code
+    /// auto y = multiply<fixed_point<int16_t, -15>>(nearest_rounding, gain, sample);
+    /// \endcode
+    ///
+    /// \tparam Output the fixed_point type of the result
+    /// \param rounding \ref floor_rounding, \ref nearest_rounding, \ref nearest_even_rounding,
+    /// \ref toward_zero_rounding or, with sg14/auxiliary/stochastic_rounding.h, \ref stochastic_rounding
+    /// \param lhs, rhs the factors
+    ///
+    /// \return lhs * rhs as Output; results beyond the range of Output wrap like those of conversion
+    ///
+    /// \sa convert, fma
+
+    template<class Output, class RoundingTag, class LhsRep, int LhsExponent, class RhsRep, int RhsExponent,
+            _impl::enable_if_t<is_rounding_tag<RoundingTag>::value, int> Dummy = 0>
+    constexpr Output multiply(
+            RoundingTag rounding,
+            fixed_point<LhsRep, LhsExponent> const& lhs,
+            fixed_point<RhsRep, RhsExponent> const& rhs)
+    {
+        return convert<Output>(rounding, multiply(lhs, rhs));
+    }
+
+    /// \brief calculates the product of two \ref fixed_point factors of the same type in that type,
+    /// rounding any digits which are lost as specified
+    /// \headerfile sg14/fixed_point
+    ///
+    /// \param rounding \ref floor_rounding, \ref nearest_rounding, \ref nearest_even_rounding,
+    /// \ref toward_zero_rounding or, with sg14/auxiliary/stochastic_rounding.h, \ref stochastic_rounding
+    /// \param lhs, rhs the factors
+    ///
+    /// \return lhs * rhs in the same representation as the factors
+    ///
+    /// \sa convert, fma
+
+    template<class RoundingTag, class Rep, int Exponent,
+            _impl::enable_if_t<is_rounding_tag<RoundingTag>::value, int> Dummy = 0>
+    constexpr fixed_point<Rep, Exponent> multiply(
+            RoundingTag rounding,
+            fixed_point<Rep, Exponent> const& lhs,
+            fixed_point<Rep, Exponent> const& rhs)
+    {
+        return multiply<fixed_point<Rep, Exponent>>(rounding, lhs, rhs);
+    }
 }
 
 #endif	// SG14_FIXED_POINT_NAMED_H
@@ -0,0 +1,243 @@
+
+//          Copyright John McFarlane 2015 - 2016.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief rounding of `sg14::fixed_point` values which lose fractional digits
+
+#if !defined(SG14_FIXED_POINT_ROUNDING_H)
+#define SG14_FIXED_POINT_ROUNDING_H 1
+
+#include "common.h"
+#include "limits.h"
+
+#include "type_traits.h"
+
+/// study group 14 of the C++ working group
+namespace sg14 {
+
+    namespace _impl {
+        namespace fp {
+            // base of the rounding tags which makes _impl::fp one of their associated namespaces,
+            // so that rounding_shift and rounding_integer find the overloads of tags declared later,
+            // e.g. in sg14/auxiliary/stochastic_rounding.h
+            struct rounding_tag_base {
+            };
+        }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // rounding tags and objects
+
+    // round toward negative infinity, as an arithmetic right shift does
+    static constexpr struct floor_rounding_tag : _impl::fp::rounding_tag_base {
+    } floor_rounding{};
+
+    // round to nearest; halfway cases are rounded toward positive infinity
+    static constexpr struct nearest_rounding_tag : _impl::fp::rounding_tag_base {
+    } nearest_rounding{};
+
+    // round to nearest; halfway cases are rounded to the nearest even value
+    static constexpr struct nearest_even_rounding_tag : _impl::fp::rounding_tag_base {
+    } nearest_even_rounding{};
+
+    // round toward zero; matches integer division and conversion between fixed_point types
+    static constexpr struct toward_zero_rounding_tag : _impl::fp::rounding_tag_base {
+    } toward_zero_rounding{};
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // sg14::is_rounding_tag
+
+    /// \brief true iff T is one of the rounding tags, e.g. \ref nearest_rounding_tag
+    /// \headerfile sg14/fixed_point
+    template<class T>
+    struct is_rounding_tag : std::false_type {
+    };
+
+    template<>
+    struct is_rounding_tag<floor_rounding_tag> : std::true_type {
+    };
+
+    template<>
+    struct is_rounding_tag<nearest_rounding_tag> : std::true_type {
+    };
+
+    template<>
+    struct is_rounding_tag<nearest_even_rounding_tag> : std::true_type {
+    };
+
+    template<>
+    struct is_rounding_tag<toward_zero_rounding_tag> : std::true_type {
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // implementation-specific definitions
+
+    namespace _impl {
+        namespace fp {
+            // value of the bit of value at position, Index
+            template<int Index, class Integer>
+            constexpr Integer rounding_bit(Integer value)
+            {
+                return (value >> Index) & Integer{1};
+            }
+
+            // true iff any of the lowest Bits bits of value are set
+            template<int Bits, class Integer, enable_if_t<(Bits==0), int> dummy = 0>
+            constexpr bool rounding_sticky(Integer)
+            {
+                return false;
+            }
+
+            // the mask is formed without shifting into the sign bit
+            template<int Bits, class Integer, enable_if_t<(Bits>0), int> dummy = 0>
+            constexpr bool rounding_sticky(Integer value)
+            {
+                return (value & (((Integer{1} << (Bits-1))-Integer{1})*Integer{2}+Integer{1}))!=Integer{0};
+            }
+
+            // number of bits in Integer, including any sign bit
+            template<class Integer>
+            struct rounding_width : std::integral_constant<int,
+                    std::numeric_limits<Integer>::digits+std::numeric_limits<Integer>::is_signed> {
+            };
+
+            // true iff shifting by Shift loses digits but leaves some of them in the result
+            template<int Shift, class Integer>
+            struct rounding_is_partial : std::integral_constant<bool,
+                    (Shift>0) && (Shift<rounding_width<Integer>::value)> {
+            };
+
+            // value * 2^-Shift where digits which are lost are rounded as specified by the tag;
+            // when every digit is lost, the result is -1 or 0
+            template<int Shift, class Integer, enable_if_t<(Shift<=0), int> dummy = 0>
+            constexpr Integer rounding_shift(floor_rounding_tag, Integer value)
+            {
+                return value*(Integer{1} << -Shift);
+            }
+
+            template<int Shift, class Integer, enable_if_t<rounding_is_partial<Shift, Integer>::value, int> dummy = 0>
+            constexpr Integer rounding_shift(floor_rounding_tag, Integer value)
+            {
+                return value >> Shift;
+            }
+
+            template<int Shift, class Integer, enable_if_t<(Shift>=rounding_width<Integer>::value), int> dummy = 0>
+            constexpr Integer rounding_shift(floor_rounding_tag, Integer value)
+            {
+                return (value<Integer{0}) ? static_cast<Integer>(-1) : Integer{0};
+            }
+
+            // true iff Integer is unsigned and shifting by Shift leaves value as a fraction, which can exceed one half
+            template<int Shift, class Integer>
+            struct rounding_is_unsigned_fraction : std::integral_constant<bool,
+                    !std::numeric_limits<Integer>::is_signed && (Shift==rounding_width<Integer>::value)> {
+            };
+
+            // otherwise, the magnitude of value is at most half of 2^Shift
+            // and halfway cases round toward zero in all other modes
+            template<int Shift, class Integer, class RoundingTag,
+                    enable_if_t<(Shift>=rounding_width<Integer>::value), int> dummy = 0>
+            constexpr Integer rounding_shift(RoundingTag, Integer)
+            {
+                return Integer{0};
+            }
+
+            template<int Shift, class Integer, enable_if_t<rounding_is_unsigned_fraction<Shift, Integer>::value, int> dummy = 0>
+            constexpr Integer rounding_shift(nearest_rounding_tag, Integer value)
+            {
+                return static_cast<Integer>(rounding_bit<Shift-1>(value));
+            }
+
+            template<int Shift, class Integer, enable_if_t<rounding_is_unsigned_fraction<Shift, Integer>::value, int> dummy = 0>
+            constexpr Integer rounding_shift(nearest_even_rounding_tag, Integer value)
+            {
+                return static_cast<Integer>(rounding_bit<Shift-1>(value) & Integer{rounding_sticky<Shift-1>(value)});
+            }
+
+            template<int Shift, class Integer, enable_if_t<(Shift<=0), int> dummy = 0>
+            constexpr Integer rounding_shift(nearest_rounding_tag, Integer value)
+            {
+                return rounding_shift<Shift>(floor_rounding, value);
+            }
+
+            // adds the bit below the result rather than adding a half to value so as not to overflow
+            template<int Shift, class Integer, enable_if_t<rounding_is_partial<Shift, Integer>::value, int> dummy = 0>
+            constexpr Integer rounding_shift(nearest_rounding_tag, Integer value)
+            {
+                return (value >> Shift)+rounding_bit<Shift-1>(value);
+            }
+
+            template<int Shift, class Integer, enable_if_t<(Shift<=0), int> dummy = 0>
+            constexpr Integer rounding_shift(nearest_even_rounding_tag, Integer value)
+            {
+                return rounding_shift<Shift>(floor_rounding, value);
+            }
+
+            template<int Shift, class Integer, enable_if_t<rounding_is_partial<Shift, Integer>::value, int> dummy = 0>
+            constexpr Integer rounding_shift(nearest_even_rounding_tag, Integer value)
+            {
+                return (value >> Shift)+(rounding_bit<Shift-1>(value)
+                        & (rounding_bit<Shift>(value) | Integer{rounding_sticky<Shift-1>(value)}));
+            }
+
+            template<int Shift, class Integer, enable_if_t<(Shift<=0), int> dummy = 0>
+            constexpr Integer rounding_shift(toward_zero_rounding_tag, Integer value)
+            {
+                return rounding_shift<Shift>(floor_rounding, value);
+            }
+
+            template<int Shift, class Integer, enable_if_t<rounding_is_partial<Shift, Integer>::value, int> dummy = 0>
+            constexpr Integer rounding_shift(toward_zero_rounding_tag, Integer value)
+            {
+                return (value >> Shift)+Integer{value<Integer{0} && rounding_sticky<Shift>(value)};
+            }
+
+            // greatest integer not greater than scaled
+            template<class Integer, class S>
+            constexpr Integer rounding_floor(S scaled)
+            {
+                return static_cast<Integer>(scaled)-Integer{static_cast<S>(static_cast<Integer>(scaled))>scaled};
+            }
+
+            // rounds up from floor, given the fraction, scaled-floor, which is calculated exactly
+            template<class Integer, class S>
+            constexpr Integer rounding_nearest_even(Integer floor, S fraction)
+            {
+                return floor+Integer{fraction>S(.5) || (fraction==S(.5) && (floor & Integer{1}))};
+            }
+
+            // floating-point value, scaled, as an integer rounded as specified by the tag
+            template<class Integer, class S>
+            constexpr Integer rounding_integer(floor_rounding_tag, S scaled)
+            {
+                return rounding_floor<Integer>(scaled);
+            }
+
+            // the fraction is compared rather than adding a half to scaled, which might round up
+            template<class Integer, class S>
+            constexpr Integer rounding_integer(nearest_rounding_tag, S scaled)
+            {
+                return rounding_floor<Integer>(scaled)
+                        +Integer{scaled-static_cast<S>(rounding_floor<Integer>(scaled))>=S(.5)};
+            }
+
+            template<class Integer, class S>
+            constexpr Integer rounding_integer(nearest_even_rounding_tag, S scaled)
+            {
+                return rounding_nearest_even(rounding_floor<Integer>(scaled),
+                        scaled-static_cast<S>(rounding_floor<Integer>(scaled)));
+            }
+
+            template<class Integer, class S>
+            constexpr Integer rounding_integer(toward_zero_rounding_tag, S scaled)
+            {
+                return static_cast<Integer>(scaled);
+            }
+        }
+    }
+}
+
+#endif	// SG14_FIXED_POINT_ROUNDING_H
@@ -81,13 +81,15 @@ namespace sg14 {
         ////////////////////////////////////////////////////////////////////////////////
         // sg14::_impl::enable_if_precedes
         
+        // class types which are not numbers, e.g. sg14::fixed_divisor, are not converted to number_base types
         template<class Former, class Latter>
         struct precedes {
             static constexpr bool value =
                     (std::is_floating_point<Former>::value && !std::is_floating_point<Latter>::value)
                             || (is_derived_from_number_base<Former>::value &&
                                     !(is_derived_from_number_base<Latter>::value
-                                            || std::is_floating_point<Latter>::value));
+                                            || std::is_floating_point<Latter>::value)
+                                    && std::numeric_limits<Latter>::is_specialized);
         };
 
         ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,79 @@
+
+//          Copyright John McFarlane 2015 - 2016.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file ../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file
+/// \brief lock-free registry of per-thread records, one list of them for each user-defined key
+
+#if !defined(SG14_THREAD_RECORDS_H)
+#define SG14_THREAD_RECORDS_H 1
+
+#include <atomic>
+
+/// study group 14 of the C++ working group
+namespace sg14 {
+
+    ////////////////////////////////////////////////////////////////////////////////
+    // implementation-specific definitions
+
+    namespace _impl {
+        ////////////////////////////////////////////////////////////////////////////////
+        // sg14::_impl::thread_record_list
+
+        // the records of every thread for one key;
+        // Record is default-constructible and has a member, Record* next
+        template<class Record>
+        struct thread_record_list {
+            char const* name;
+            std::atomic<Record*> records;
+            thread_record_list* next;
+        };
+
+        // pushes node onto a list which is never popped, so that readers need no lock
+        template<class Node>
+        Node* push_thread_record(std::atomic<Node*>& head, Node* node)
+        {
+            node->next = head.load(std::memory_order_relaxed);
+            while (!head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+            }
+            return node;
+        }
+
+        // every key which has a Record;
+        // nodes are never freed so that records outlive the threads which made them
+        template<class Record>
+        std::atomic<thread_record_list<Record>*>& thread_record_lists()
+        {
+            static std::atomic<thread_record_list<Record>*> lists{nullptr};
+            return lists;
+        }
+
+        // the records of Key, a type with a static member function, name(), returning a null-terminated string
+        template<class Record, class Key>
+        thread_record_list<Record>& thread_records()
+        {
+            static auto list = push_thread_record(thread_record_lists<Record>(),
+                    new thread_record_list<Record>{Key::name(), {nullptr}, nullptr});
+            return *list;
+        }
+
+        // the calling thread's Record for Key, registered on first use
+        template<class Record, class Key>
+        Record& thread_record()
+        {
+            static thread_local auto record = push_thread_record(thread_records<Record, Key>().records, new Record{});
+            return *record;
+        }
+
+        // only the owning thread writes a record, so no read-modify-write instruction is needed
+        template<class Integer>
+        void store_thread_record(std::atomic<Integer>& destination, Integer value)
+        {
+            destination.store(value, std::memory_order_relaxed);
+        }
+    }
+}
+
+#endif	// SG14_THREAD_RECORDS_H
@@ -453,6 +453,16 @@ namespace sg14 {
         -> decltype(sg14::scale<T>()(i, base, exp)) {
             return sg14::scale<T>()(i, base, exp);
         }
+
+        // scale<T>(i, base, exp) where i is not a T, as shift_left calls it when T is the wider type;
+        // i is passed to sg14::scale<T> unconverted so that a specialization which accepts other input types,
+        // such as that of number_base, needn't construct a temporary T; that temporary could have side effects,
+        // e.g. a ranged_integer would record the unscaled value of every integer converted to a ranged fixed_point
+        template<class T, class Input, enable_if_t<!std::is_same<T, Input>::value, int> Dummy = 0>
+        constexpr auto scale(const Input &i, int base, int exp)
+        -> decltype(sg14::scale<T>()(i, base, exp)) {
+            return sg14::scale<T>()(i, base, exp);
+        }
     }
 }
 
@@ -6,8 +6,17 @@
 
 #include "sample_functions.h"
 
+#include <sg14/auxiliary/fixed_point_array.h>
+#include <sg14/auxiliary/overflow_counting.h>
+#include <sg14/auxiliary/precise_integer.h>
+#include <sg14/auxiliary/safe_integer.h>
+#include <sg14/auxiliary/stochastic_rounding.h>
+
 #include <benchmark/benchmark.h>
 
+#include <random>
+#include <vector>
+
 #define ESCAPE(X) escape_cppcon2015(&X)
 //#define ESCAPE(X) escape_codedive2015(&X)
 //#define ESCAPE(x) benchmark::DoNotOptimize(x)
@@ -111,6 +120,366 @@ static void div(benchmark::State& state)
     }
 }
 
+template<class T>
+T reciprocal_divide(T x, T y)
+{
+    return x/y;
+}
+
+template<class Rep, int Exponent>
+sg14::fixed_point<Rep, Exponent> reciprocal_divide(sg14::fixed_point<Rep, Exponent> x, sg14::fixed_point<Rep, Exponent> y)
+{
+    return divide(sg14::fast_reciprocal, x, y);
+}
+
+// division with a result of the same type as the operands
+template<class T>
+static void bm_div_narrow(benchmark::State& state)
+{
+    auto nume = static_cast<T>(numeric_limits<T>::max()/int8_t{5});
+    auto denom = static_cast<T>(numeric_limits<T>::max()/int8_t{3});
+    while (state.KeepRunning()) {
+        ESCAPE(nume);
+        ESCAPE(denom);
+        auto value = static_cast<T>(nume/denom);
+        ESCAPE(value);
+    }
+}
+
+template<class T>
+static void bm_div_reciprocal(benchmark::State& state)
+{
+    auto nume = static_cast<T>(numeric_limits<T>::max()/int8_t{5});
+    auto denom = static_cast<T>(numeric_limits<T>::max()/int8_t{3});
+    while (state.KeepRunning()) {
+        ESCAPE(nume);
+        ESCAPE(denom);
+        auto value = reciprocal_divide(nume, denom);
+        ESCAPE(value);
+    }
+}
+
+template<class T>
+T make_divisor(T divisor)
+{
+    return divisor;
+}
+
+template<class Rep, int Exponent>
+sg14::fixed_divisor<sg14::fixed_point<Rep, Exponent>> make_divisor(sg14::fixed_point<Rep, Exponent> divisor)
+{
+    return sg14::fixed_divisor<sg14::fixed_point<Rep, Exponent>>{divisor};
+}
+
+// division by a divisor which is prepared outside the loop
+template<class T>
+static void bm_div_invariant(benchmark::State& state)
+{
+    auto nume = static_cast<T>(numeric_limits<T>::max()/int8_t{5});
+    auto denom = make_divisor(static_cast<T>(numeric_limits<T>::max()/int8_t{3}));
+    while (state.KeepRunning()) {
+        ESCAPE(nume);
+        ESCAPE(denom);
+        auto value = static_cast<T>(nume/denom);
+        ESCAPE(value);
+    }
+}
+
+template<class T>
+T fused_multiply_add(T a, T b, T c)
+{
+    return std::fma(a, b, c);
+}
+
+template<class Rep, int Exponent>
+sg14::fixed_point<Rep, Exponent> fused_multiply_add(
+        sg14::fixed_point<Rep, Exponent> a, sg14::fixed_point<Rep, Exponent> b, sg14::fixed_point<Rep, Exponent> c)
+{
+    return sg14::fma(sg14::nearest_rounding, a, b, c);
+}
+
+// multiply then add, converting the product back to the type of the operands
+template<class T>
+static void bm_multiply_add(benchmark::State& state)
+{
+    auto factor1 = static_cast<T>(1.25);
+    auto factor2 = static_cast<T>(-2.5);
+    auto addend = static_cast<T>(3.75);
+    while (state.KeepRunning()) {
+        ESCAPE(factor1);
+        ESCAPE(factor2);
+        ESCAPE(addend);
+        auto value = static_cast<T>(static_cast<T>(factor1*factor2)+addend);
+        ESCAPE(value);
+    }
+}
+
+template<class T>
+static void bm_fma(benchmark::State& state)
+{
+    auto factor1 = static_cast<T>(1.25);
+    auto factor2 = static_cast<T>(-2.5);
+    auto addend = static_cast<T>(3.75);
+    while (state.KeepRunning()) {
+        ESCAPE(factor1);
+        ESCAPE(factor2);
+        ESCAPE(addend);
+        auto value = fused_multiply_add(factor1, factor2, addend);
+        ESCAPE(value);
+    }
+}
+
+// multiply, rounding the product to nearest rather than discarding lost digits
+template<class T>
+static void bm_mul_nearest(benchmark::State& state)
+{
+    auto factor1 = static_cast<T>(.625);
+    auto factor2 = static_cast<T>(.3);
+    while (state.KeepRunning()) {
+        ESCAPE(factor1);
+        ESCAPE(factor2);
+        auto value = multiply(sg14::nearest_rounding, factor1, factor2);
+        ESCAPE(value);
+    }
+}
+
+// narrowing conversion to a type with half as many fractional digits
+template<class T>
+using narrowed = sg14::fixed_point<sg14::set_digits_t<typename T::rep, sg14::digits<T>::value/2>, T::exponent/2>;
+
+template<class T, class RoundingTag>
+static void bm_narrow(benchmark::State& state)
+{
+    auto input = static_cast<T>(.3);
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = sg14::convert<narrowed<T>>(RoundingTag{}, input);
+        ESCAPE(output);
+    }
+}
+
+// an array of narrowing conversions, rounded as specified by the rep if it is precise_integer;
+// reported per element
+template<class T>
+static void bm_narrow_array(benchmark::State& state)
+{
+    T input[256];
+    for (auto i = 0; i!=256; ++i) {
+        input[i] = static_cast<T>((i-128)/256.);
+    }
+    narrowed<T> output[256];
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        for (auto i = 0; i!=256; ++i) {
+            output[i] = static_cast<narrowed<T>>(input[i]);
+        }
+        ESCAPE(output);
+    }
+    state.SetItemsProcessed(state.iterations()*256);
+}
+
+template<class T>
+static void bm_narrow_array_stochastic(benchmark::State& state)
+{
+    T input[256];
+    for (auto i = 0; i!=256; ++i) {
+        input[i] = static_cast<T>((i-128)/256.);
+    }
+    narrowed<T> output[256];
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        sg14::convert(sg14::stochastic_rounding, input, output, 256);
+        ESCAPE(output);
+    }
+    state.SetItemsProcessed(state.iterations()*256);
+}
+
+// operands whose results can be represented so that throwing types do not throw
+template<class T>
+static void bm_checked_add(benchmark::State& state)
+{
+    auto addend1 = T{1000000};
+    auto addend2 = T{-3000};
+    while (state.KeepRunning()) {
+        ESCAPE(addend1);
+        ESCAPE(addend2);
+        auto value = addend1+addend2;
+        ESCAPE(value);
+    }
+}
+
+template<class T>
+static void bm_checked_mul(benchmark::State& state)
+{
+    auto factor1 = T{40000};
+    auto factor2 = T{-50000};
+    while (state.KeepRunning()) {
+        ESCAPE(factor1);
+        ESCAPE(factor2);
+        auto value = factor1*factor2;
+        ESCAPE(value);
+    }
+}
+
+// integer with Bits significant digits and random sign
+template<class T>
+static T near_limit(std::mt19937_64& generator, int bits)
+{
+    auto magnitude = static_cast<T>((generator() >> (64-bits)) | (UINT64_C(1) << (bits-1)));
+    return (generator() & 1) ? static_cast<T>(-magnitude) : magnitude;
+}
+
+template<class OverflowTag>
+struct overflow_add {
+    template<class T>
+    T operator()(T lhs, T rhs) const { return sg14::add(OverflowTag{}, lhs, rhs); }
+};
+
+template<class OverflowTag>
+struct overflow_sub {
+    template<class T>
+    T operator()(T lhs, T rhs) const { return sg14::subtract(OverflowTag{}, lhs, rhs); }
+};
+
+template<class OverflowTag>
+struct overflow_mul {
+    template<class T>
+    T operator()(T lhs, T rhs) const { return sg14::multiply(OverflowTag{}, lhs, rhs); }
+};
+
+// factors have half as many digits so that only some products overflow
+template<class Operation>
+struct is_overflow_mul : std::false_type {
+};
+
+template<class OverflowTag>
+struct is_overflow_mul<overflow_mul<OverflowTag>> : std::true_type {
+};
+
+// full-scale operands of random sign so that results overflow unpredictably, as with noisy audio;
+// operands are drawn from a different part of a pool on each iteration
+// so that the branch predictor cannot learn the outcomes; reported per element
+template<class T, class Operation>
+static void bm_overflow_array(benchmark::State& state)
+{
+    std::mt19937_64 generator;
+    static T lhs[256], rhs[65536], output[256];
+    auto operand = [&] {
+        return near_limit<T>(generator, is_overflow_mul<Operation>::value
+                ? numeric_limits<T>::digits/2+static_cast<int>(generator() & 1)
+                : numeric_limits<T>::digits);
+    };
+    for (auto& element : lhs) {
+        element = operand();
+    }
+    for (auto& element : rhs) {
+        element = operand();
+    }
+    while (state.KeepRunning()) {
+        auto pool = rhs+(generator() & 65280);
+        ESCAPE(lhs);
+        ESCAPE(pool);
+        for (auto i = 0; i!=256; ++i) {
+            output[i] = Operation()(lhs[i], pool[i]);
+        }
+        ESCAPE(output);
+    }
+    state.SetItemsProcessed(state.iterations()*256);
+}
+
+// values of twice the range of T, half of which do not fit
+template<class T, class OverflowTag>
+static void bm_overflow_convert_array(benchmark::State& state)
+{
+    std::mt19937_64 generator;
+    static std::int64_t input[65536];
+    static T output[256];
+    for (auto i = 0; i!=65536; ++i) {
+        input[i] = near_limit<std::int64_t>(generator, numeric_limits<T>::digits+1);
+    }
+    while (state.KeepRunning()) {
+        auto pool = input+(generator() & 65280);
+        ESCAPE(pool);
+        for (auto i = 0; i!=256; ++i) {
+            output[i] = sg14::convert<T>(OverflowTag{}, pool[i]);
+        }
+        ESCAPE(output);
+    }
+    state.SetItemsProcessed(state.iterations()*256);
+}
+
+// element-wise arithmetic by the bulk functions
+struct bulk_add {
+    template<class T>
+    void operator()(T const* lhs, T const* rhs, T* output, std::size_t size) const
+    {
+        sg14::transform_add(lhs, rhs, output, size);
+    }
+};
+
+struct bulk_multiply {
+    template<class T>
+    void operator()(T const* lhs, T const* rhs, T* output, std::size_t size) const
+    {
+        sg14::transform_multiply(lhs, rhs, output, size);
+    }
+};
+
+// the same arithmetic by a loop of scalar operators
+struct loop_add {
+    template<class T>
+    void operator()(T const* lhs, T const* rhs, T* output, std::size_t size) const
+    {
+        for (auto i = std::size_t{0}; i!=size; ++i) {
+            output[i] = static_cast<T>(lhs[i]+rhs[i]);
+        }
+    }
+};
+
+struct loop_multiply {
+    template<class T>
+    void operator()(T const* lhs, T const* rhs, T* output, std::size_t size) const
+    {
+        for (auto i = std::size_t{0}; i!=size; ++i) {
+            output[i] = static_cast<T>(lhs[i]*rhs[i]);
+        }
+    }
+};
+
+// operands have half as many digits as T so that no product overflows; reported per element
+template<class T, class Operation>
+static void bm_array(benchmark::State& state)
+{
+    std::mt19937_64 generator;
+    auto operand = [&] {
+        return T::from_data(static_cast<typename T::rep>(
+                static_cast<std::int64_t>(generator()) >> (64-numeric_limits<T>::digits/2)));
+    };
+    std::vector<T> lhs, rhs;
+    for (auto i = 0; i!=1024; ++i) {
+        lhs.push_back(operand());
+        rhs.push_back(operand());
+    }
+    auto output = lhs;
+    while (state.KeepRunning()) {
+        ESCAPE(lhs[0]);
+        ESCAPE(rhs[0]);
+        Operation()(lhs.data(), rhs.data(), output.data(), 1024);
+        ESCAPE(output[0]);
+    }
+    state.SetItemsProcessed(state.iterations()*1024);
+}
+
+// the bulk functions with kernels of the given level or the highest level which the processor supports
+template<class T, class Operation, sg14::simd_level Level>
+static void bm_array_level(benchmark::State& state)
+{
+    auto initial = sg14::get_simd_level();
+    sg14::set_simd_level(Level);
+    bm_array<T, Operation>(state);
+    sg14::set_simd_level(initial);
+}
+
 template<class T>
 static void bm_sqrt(benchmark::State& state)
 {
@@ -122,6 +491,278 @@ static void bm_sqrt(benchmark::State& state)
     }
 }
 
+template<class T>
+T reciprocal_sqrt(T x)
+{
+    return T{1}/sqrt(x);
+}
+
+template<class Rep, int Exponent>
+sg14::fixed_point<Rep, Exponent> reciprocal_sqrt(sg14::fixed_point<Rep, Exponent> x)
+{
+    return rsqrt(x);
+}
+
+template<class T>
+static void bm_rsqrt(benchmark::State& state)
+{
+    auto input = static_cast<T>(1.25);
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = reciprocal_sqrt(input);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_floor(benchmark::State& state)
+{
+    auto input = static_cast<T>(-1.25);
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = floor(input);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_ceil(benchmark::State& state)
+{
+    auto input = static_cast<T>(-1.25);
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = ceil(input);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_trunc(benchmark::State& state)
+{
+    auto input = static_cast<T>(-1.25);
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = trunc(input);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_round(benchmark::State& state)
+{
+    auto input = static_cast<T>(-1.5);
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = round(input);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_fmod(benchmark::State& state)
+{
+    auto numerator = static_cast<T>(7.75);
+    auto denominator = static_cast<T>(1.5);
+    while (state.KeepRunning()) {
+        ESCAPE(numerator);
+        ESCAPE(denominator);
+        auto output = fmod(numerator, denominator);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_sin(benchmark::State& state)
+{
+    auto input = static_cast<T>(1.25);
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = sin(input);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_cos(benchmark::State& state)
+{
+    auto input = static_cast<T>(1.25);
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = cos(input);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_atan(benchmark::State& state)
+{
+    auto input = static_cast<T>(1.25);
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = atan(input);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_atan2(benchmark::State& state)
+{
+    auto y = static_cast<T>(1.25);
+    auto x = static_cast<T>(-.75);
+    while (state.KeepRunning()) {
+        ESCAPE(y);
+        ESCAPE(x);
+        auto output = atan2(y, x);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_hypot(benchmark::State& state)
+{
+    auto x = static_cast<T>(1.25);
+    auto y = static_cast<T>(-.75);
+    while (state.KeepRunning()) {
+        ESCAPE(x);
+        ESCAPE(y);
+        auto output = hypot(x, y);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_exp(benchmark::State& state)
+{
+    auto input = static_cast<T>(1.25);
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = exp(input);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_log(benchmark::State& state)
+{
+    auto input = static_cast<T>(1.25);
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = log(input);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_pow(benchmark::State& state)
+{
+    auto base = static_cast<T>(1.25);
+    auto exponent = static_cast<T>(1.5);
+    while (state.KeepRunning()) {
+        ESCAPE(base);
+        ESCAPE(exponent);
+        auto output = pow(base, exponent);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_pow_int(benchmark::State& state)
+{
+    auto base = static_cast<T>(1.25);
+    auto exponent = 3;
+    while (state.KeepRunning()) {
+        ESCAPE(base);
+        ESCAPE(exponent);
+        auto output = pow(base, exponent);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+T logistic(T x)
+{
+    return T{1}/(T{1}+exp(-x));
+}
+
+template<class Rep, int Exponent>
+sg14::fixed_point<Rep, Exponent> logistic(sg14::fixed_point<Rep, Exponent> x)
+{
+    return sigmoid(x);
+}
+
+template<class T>
+T soft_plus(T x)
+{
+    return log1p(exp(x));
+}
+
+template<class Rep, int Exponent>
+sg14::fixed_point<Rep, Exponent> soft_plus(sg14::fixed_point<Rep, Exponent> x)
+{
+    return softplus(x);
+}
+
+template<class T>
+static void bm_sigmoid(benchmark::State& state)
+{
+    auto input = static_cast<T>(-.75);
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = logistic(input);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_tanh(benchmark::State& state)
+{
+    auto input = static_cast<T>(-.75);
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = tanh(input);
+        ESCAPE(output);
+    }
+}
+
+template<class T>
+static void bm_softplus(benchmark::State& state)
+{
+    auto input = static_cast<T>(-.75);
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = soft_plus(input);
+        ESCAPE(output);
+    }
+}
+
+// a layer of activations; reported per element
+template<class T>
+static void bm_sigmoid_layer(benchmark::State& state)
+{
+    T layer[256];
+    for (auto i = 0; i!=256; ++i) {
+        layer[i] = static_cast<T>((i-128)/64.);
+    }
+    T output[256];
+    while (state.KeepRunning()) {
+        ESCAPE(layer);
+        sigmoid(layer, output, 256);
+        ESCAPE(output);
+    }
+    state.SetItemsProcessed(state.iterations()*256);
+}
+
+template<class Lut>
+static void bm_lut(benchmark::State& state)
+{
+    auto input = static_cast<typename Lut::input_type>(1.25);
+    while (state.KeepRunning()) {
+        ESCAPE(input);
+        auto output = Lut::evaluate(input);
+        ESCAPE(output);
+    }
+}
+
 template<class T>
 static void bm_magnitude_squared(benchmark::State& state)
 {
@@ -191,6 +832,51 @@ using s15_16 = make_fixed<15, 16>;
 using u32_32 = make_ufixed<32, 32>;
 using s31_32 = make_fixed<31, 32>;
 
+// quantized formats of neural networks
+template<class RoundingPolicy>
+using precise_s15_16 = sg14::fixed_point<sg14::precise_integer<std::int32_t, RoundingPolicy>, -16>;
+template<class RoundingPolicy>
+using precise_s31_32 = sg14::fixed_point<sg14::precise_integer<std::int64_t, RoundingPolicy>, -32>;
+
+using q7 = make_fixed<0, 7>;
+using q15 = make_fixed<0, 15>;
+
+// quantized formats whose arithmetic saturates
+using saturated_q7 = sg14::fixed_point<sg14::safe_integer<std::int8_t, sg14::saturated_overflow_tag>, -7>;
+using saturated_q15 = sg14::fixed_point<sg14::safe_integer<std::int16_t, sg14::saturated_overflow_tag>, -15>;
+
+// integers whose arithmetic is checked for overflow
+// key of overflows counted by benchmarks
+struct benchmark_site {
+    static char const* name() { return "benchmark_site"; }
+};
+
+using counting_overflow_tag = sg14::counting_overflow_tag<benchmark_site>;
+
+template<class OverflowTag>
+using safe_int32 = sg14::safe_integer<int32_t, OverflowTag>;
+template<class OverflowTag>
+using safe_int64 = sg14::safe_integer<int64_t, OverflowTag>;
+
+////////////////////////////////////////////////////////////////////////////////
+// look-up tables
+
+using s3_12 = make_fixed<3, 12>;
+using s3_28 = make_fixed<3, 28>;
+
+struct lut_sin_function {
+    constexpr s3_28 operator()(s3_12 x) const { return sin(s3_28{x}); }
+};
+
+struct lut_exp_function {
+    constexpr s15_16 operator()(s3_12 x) const { return exp(s15_16{x}); }
+};
+
+using lut_sin_linear = sg14::fixed_point_lut<lut_sin_function, s3_12, s3_28, 8>;
+using lut_sin_quadratic = sg14::fixed_point_lut<lut_sin_function, s3_12, s3_28, 6, sg14::quadratic_interpolation_tag>;
+using lut_exp_linear = sg14::fixed_point_lut<lut_exp_function, s3_12, s15_16, 8>;
+using lut_exp_quadratic = sg14::fixed_point_lut<lut_exp_function, s3_12, s15_16, 6, sg14::quadratic_interpolation_tag>;
+
 ////////////////////////////////////////////////////////////////////////////////
 // multi-type benchmark macros
 
@@ -245,6 +931,99 @@ FIXED_POINT_BENCHMARK_COMPLETE(add);
 FIXED_POINT_BENCHMARK_COMPLETE(sub);
 FIXED_POINT_BENCHMARK_COMPLETE(mul);
 FIXED_POINT_BENCHMARK_COMPLETE(div);
+FIXED_POINT_BENCHMARK_REAL(bm_div_narrow);
+FIXED_POINT_BENCHMARK_REAL(bm_div_reciprocal);
+FIXED_POINT_BENCHMARK_REAL(bm_div_invariant);
+FIXED_POINT_BENCHMARK_FLOAT(bm_fma);
+BENCHMARK_TEMPLATE1(bm_multiply_add, q15);
+BENCHMARK_TEMPLATE1(bm_fma, q15);
+BENCHMARK_TEMPLATE1(bm_multiply_add, s15_16);
+BENCHMARK_TEMPLATE1(bm_fma, s15_16);
+#if defined(SG14_INT128_ENABLED)
+BENCHMARK_TEMPLATE1(bm_multiply_add, s31_32);
+BENCHMARK_TEMPLATE1(bm_fma, s31_32);
+#endif
+FIXED_POINT_BENCHMARK_FIXED(bm_mul_nearest);
+BENCHMARK_TEMPLATE1(mul, q15);
+BENCHMARK_TEMPLATE1(bm_mul_nearest, q15);
+
+// stochastic rounding compared with floor rounding
+BENCHMARK_TEMPLATE2(bm_narrow, s15_16, sg14::floor_rounding_tag);
+BENCHMARK_TEMPLATE2(bm_narrow, s15_16, sg14::stochastic_rounding_tag);
+BENCHMARK_TEMPLATE2(bm_narrow, s31_32, sg14::floor_rounding_tag);
+BENCHMARK_TEMPLATE2(bm_narrow, s31_32, sg14::stochastic_rounding_tag);
+BENCHMARK_TEMPLATE1(bm_narrow_array, s15_16);
+BENCHMARK_TEMPLATE1(bm_narrow_array_stochastic, s15_16);
+BENCHMARK_TEMPLATE1(bm_narrow_array, s31_32);
+BENCHMARK_TEMPLATE1(bm_narrow_array_stochastic, s31_32);
+
+// narrowing of precise_integer reps, rounded in the integer domain
+BENCHMARK_TEMPLATE1(bm_narrow_array, precise_s15_16<sg14::closest_rounding_policy>);
+BENCHMARK_TEMPLATE1(bm_narrow_array, precise_s15_16<sg14::nearest_even_rounding_policy>);
+BENCHMARK_TEMPLATE1(bm_narrow_array, precise_s15_16<sg14::floor_rounding_policy>);
+BENCHMARK_TEMPLATE1(bm_narrow_array, precise_s31_32<sg14::closest_rounding_policy>);
+BENCHMARK_TEMPLATE1(bm_narrow_array, precise_s31_32<sg14::nearest_even_rounding_policy>);
+BENCHMARK_TEMPLATE1(bm_narrow_array, precise_s31_32<sg14::floor_rounding_policy>);
+
+// overflow detection compared with unchecked arithmetic
+BENCHMARK_TEMPLATE1(bm_checked_add, int32_t);
+BENCHMARK_TEMPLATE1(bm_checked_add, safe_int32<sg14::native_overflow_tag>);
+BENCHMARK_TEMPLATE1(bm_checked_add, safe_int32<sg14::throwing_overflow_tag>);
+BENCHMARK_TEMPLATE1(bm_checked_add, safe_int32<sg14::saturated_overflow_tag>);
+BENCHMARK_TEMPLATE1(bm_checked_add, safe_int32<sg14::sticky_overflow_tag>);
+BENCHMARK_TEMPLATE1(bm_checked_add, int64_t);
+BENCHMARK_TEMPLATE1(bm_checked_add, safe_int64<sg14::native_overflow_tag>);
+BENCHMARK_TEMPLATE1(bm_checked_add, safe_int64<sg14::throwing_overflow_tag>);
+BENCHMARK_TEMPLATE1(bm_checked_add, safe_int64<sg14::saturated_overflow_tag>);
+BENCHMARK_TEMPLATE1(bm_checked_add, safe_int64<sg14::sticky_overflow_tag>);
+BENCHMARK_TEMPLATE1(bm_checked_mul, int32_t);
+BENCHMARK_TEMPLATE1(bm_checked_mul, safe_int32<sg14::native_overflow_tag>);
+BENCHMARK_TEMPLATE1(bm_checked_mul, safe_int32<sg14::throwing_overflow_tag>);
+BENCHMARK_TEMPLATE1(bm_checked_mul, safe_int32<sg14::saturated_overflow_tag>);
+BENCHMARK_TEMPLATE1(bm_checked_mul, safe_int32<sg14::sticky_overflow_tag>);
+BENCHMARK_TEMPLATE1(bm_checked_mul, int64_t);
+BENCHMARK_TEMPLATE1(bm_checked_mul, safe_int64<sg14::native_overflow_tag>);
+BENCHMARK_TEMPLATE1(bm_checked_mul, safe_int64<sg14::throwing_overflow_tag>);
+BENCHMARK_TEMPLATE1(bm_checked_mul, safe_int64<sg14::saturated_overflow_tag>);
+BENCHMARK_TEMPLATE1(bm_checked_mul, safe_int64<sg14::sticky_overflow_tag>);
+
+// saturation of results which overflow unpredictably compared with wrap-around
+BENCHMARK_TEMPLATE2(bm_overflow_array, int32_t, overflow_add<sg14::native_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int32_t, overflow_add<sg14::saturated_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int32_t, overflow_sub<sg14::native_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int32_t, overflow_sub<sg14::saturated_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int32_t, overflow_mul<sg14::native_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int32_t, overflow_mul<sg14::saturated_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int64_t, overflow_add<sg14::native_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int64_t, overflow_add<sg14::saturated_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int64_t, overflow_sub<sg14::native_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int64_t, overflow_sub<sg14::saturated_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int64_t, overflow_mul<sg14::native_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int64_t, overflow_mul<sg14::saturated_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_convert_array, int8_t, sg14::native_overflow_tag);
+BENCHMARK_TEMPLATE2(bm_overflow_convert_array, int8_t, sg14::saturated_overflow_tag);
+BENCHMARK_TEMPLATE2(bm_overflow_convert_array, int16_t, sg14::native_overflow_tag);
+BENCHMARK_TEMPLATE2(bm_overflow_convert_array, int16_t, sg14::saturated_overflow_tag);
+BENCHMARK_TEMPLATE2(bm_overflow_convert_array, int32_t, sg14::native_overflow_tag);
+BENCHMARK_TEMPLATE2(bm_overflow_convert_array, int32_t, sg14::saturated_overflow_tag);
+
+// recording overflow in a flag compared with wrap-around
+BENCHMARK_TEMPLATE2(bm_overflow_array, int32_t, overflow_add<sg14::sticky_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int32_t, overflow_sub<sg14::sticky_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int32_t, overflow_mul<sg14::sticky_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int64_t, overflow_add<sg14::sticky_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int64_t, overflow_sub<sg14::sticky_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int64_t, overflow_mul<sg14::sticky_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_convert_array, int8_t, sg14::sticky_overflow_tag);
+BENCHMARK_TEMPLATE2(bm_overflow_convert_array, int16_t, sg14::sticky_overflow_tag);
+BENCHMARK_TEMPLATE2(bm_overflow_convert_array, int32_t, sg14::sticky_overflow_tag);
+
+// counting overflows by call site on top of saturation
+BENCHMARK_TEMPLATE2(bm_overflow_array, int32_t, overflow_add<counting_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int32_t, overflow_mul<counting_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int64_t, overflow_add<counting_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_array, int64_t, overflow_mul<counting_overflow_tag>);
+BENCHMARK_TEMPLATE2(bm_overflow_convert_array, int16_t, counting_overflow_tag);
 
 FIXED_POINT_BENCHMARK_REAL(bm_magnitude_squared);
 
@@ -252,3 +1031,78 @@ FIXED_POINT_BENCHMARK_REAL(bm_circle_intersect_generic);
 
 // tests involving unoptimized math function, sg14::sqrt
 FIXED_POINT_BENCHMARK_REAL(bm_sqrt);
+FIXED_POINT_BENCHMARK_REAL(bm_rsqrt);
+
+// rounding functions
+FIXED_POINT_BENCHMARK_REAL(bm_floor);
+FIXED_POINT_BENCHMARK_REAL(bm_ceil);
+FIXED_POINT_BENCHMARK_REAL(bm_trunc);
+FIXED_POINT_BENCHMARK_REAL(bm_round);
+FIXED_POINT_BENCHMARK_REAL(bm_fmod);
+
+// trigonometric functions
+FIXED_POINT_BENCHMARK_REAL(bm_sin);
+FIXED_POINT_BENCHMARK_REAL(bm_cos);
+FIXED_POINT_BENCHMARK_REAL(bm_atan);
+FIXED_POINT_BENCHMARK_REAL(bm_atan2);
+FIXED_POINT_BENCHMARK_REAL(bm_hypot);
+
+// exponential and logarithmic functions
+FIXED_POINT_BENCHMARK_REAL(bm_exp);
+FIXED_POINT_BENCHMARK_REAL(bm_log);
+FIXED_POINT_BENCHMARK_REAL(bm_pow);
+FIXED_POINT_BENCHMARK_REAL(bm_pow_int);
+
+// activation functions
+FIXED_POINT_BENCHMARK_REAL(bm_sigmoid);
+BENCHMARK_TEMPLATE1(bm_sigmoid, q7);
+BENCHMARK_TEMPLATE1(bm_sigmoid, q15);
+FIXED_POINT_BENCHMARK_REAL(bm_tanh);
+BENCHMARK_TEMPLATE1(bm_tanh, q7);
+BENCHMARK_TEMPLATE1(bm_tanh, q15);
+FIXED_POINT_BENCHMARK_REAL(bm_softplus);
+BENCHMARK_TEMPLATE1(bm_softplus, q7);
+BENCHMARK_TEMPLATE1(bm_softplus, q15);
+BENCHMARK_TEMPLATE1(bm_sigmoid_layer, q7);
+BENCHMARK_TEMPLATE1(bm_sigmoid_layer, q15);
+BENCHMARK_TEMPLATE1(bm_sigmoid_layer, s15_16);
+
+// element-wise arithmetic on arrays by SIMD kernels compared with loops of scalar operators
+BENCHMARK_TEMPLATE2(bm_array, q7, loop_add);
+BENCHMARK_TEMPLATE2(bm_array, q7, bulk_add);
+BENCHMARK_TEMPLATE2(bm_array, q7, loop_multiply);
+BENCHMARK_TEMPLATE2(bm_array, q7, bulk_multiply);
+BENCHMARK_TEMPLATE2(bm_array, q15, loop_add);
+BENCHMARK_TEMPLATE2(bm_array, q15, bulk_add);
+BENCHMARK_TEMPLATE2(bm_array, q15, loop_multiply);
+BENCHMARK_TEMPLATE2(bm_array, q15, bulk_multiply);
+BENCHMARK_TEMPLATE2(bm_array, s15_16, loop_add);
+BENCHMARK_TEMPLATE2(bm_array, s15_16, bulk_add);
+BENCHMARK_TEMPLATE2(bm_array, s15_16, loop_multiply);
+BENCHMARK_TEMPLATE2(bm_array, s15_16, bulk_multiply);
+BENCHMARK_TEMPLATE2(bm_array, saturated_q7, loop_add);
+BENCHMARK_TEMPLATE2(bm_array, saturated_q7, bulk_add);
+BENCHMARK_TEMPLATE2(bm_array, saturated_q7, loop_multiply);
+BENCHMARK_TEMPLATE2(bm_array, saturated_q7, bulk_multiply);
+BENCHMARK_TEMPLATE2(bm_array, saturated_q15, loop_add);
+BENCHMARK_TEMPLATE2(bm_array, saturated_q15, bulk_add);
+BENCHMARK_TEMPLATE2(bm_array, saturated_q15, loop_multiply);
+BENCHMARK_TEMPLATE2(bm_array, saturated_q15, bulk_multiply);
+
+// the same kernels at each level of instruction set
+BENCHMARK_TEMPLATE(bm_array_level, q15, bulk_multiply, sg14::simd_level::none);
+BENCHMARK_TEMPLATE(bm_array_level, q15, bulk_multiply, sg14::simd_level::sse2);
+BENCHMARK_TEMPLATE(bm_array_level, q15, bulk_multiply, sg14::simd_level::sse41);
+BENCHMARK_TEMPLATE(bm_array_level, q15, bulk_multiply, sg14::simd_level::avx2);
+BENCHMARK_TEMPLATE(bm_array_level, q15, bulk_multiply, sg14::simd_level::avx512);
+BENCHMARK_TEMPLATE(bm_array_level, s15_16, bulk_multiply, sg14::simd_level::sse2);
+BENCHMARK_TEMPLATE(bm_array_level, s15_16, bulk_multiply, sg14::simd_level::sse41);
+BENCHMARK_TEMPLATE(bm_array_level, s15_16, bulk_multiply, sg14::simd_level::avx2);
+BENCHMARK_TEMPLATE(bm_array_level, s15_16, bulk_multiply, sg14::simd_level::avx512);
+
+// look-up tables compared with the functions they sample
+BENCHMARK_TEMPLATE1(bm_sin, s3_28);
+BENCHMARK_TEMPLATE1(bm_lut, lut_sin_linear);
+BENCHMARK_TEMPLATE1(bm_lut, lut_sin_quadratic);
+BENCHMARK_TEMPLATE1(bm_lut, lut_exp_linear);
+BENCHMARK_TEMPLATE1(bm_lut, lut_exp_quadratic);
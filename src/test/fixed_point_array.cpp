@@ -0,0 +1,240 @@
+
+//          Copyright John McFarlane 2015 - 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sg14/auxiliary/fixed_point_array.h>
+#include <sg14/auxiliary/safe_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+using sg14::fixed_point;
+using sg14::simd_level;
+
+namespace {
+    // more elements than fill several registers, with some left over for the scalar operators
+    constexpr auto array_size = 203;
+
+    // array of values of T whose reps have no more than the given number of digits
+    template<class T>
+    std::vector<T> random_array(int digits)
+    {
+        using rep = typename T::rep;
+        static std::mt19937_64 generator;
+        auto max = (std::int64_t{1} << digits)-1;
+        auto min = std::is_signed<rep>::value ? -max-1 : 0;
+        std::uniform_int_distribution<std::int64_t> distribution(min, max);
+
+        std::vector<T> values;
+        for (auto i = 0; i!=array_size; ++i) {
+            values.push_back(T::from_data(static_cast<rep>(distribution(generator))));
+        }
+        return values;
+    }
+
+    template<class T>
+    std::vector<T> random_array()
+    {
+        return random_array<T>(std::numeric_limits<typename T::rep>::digits);
+    }
+
+    template<class T>
+    long long rep_of(T const& value)
+    {
+        return static_cast<long long>(value.data());
+    }
+
+    template<class Output, class Lhs, class Rhs>
+    void expect_add(std::vector<Lhs> const& lhs, std::vector<Rhs> const& rhs)
+    {
+        std::vector<Output> sum(lhs.size(), Output{0}), difference(lhs.size(), Output{0});
+        sg14::transform_add(lhs.data(), rhs.data(), sum.data(), sum.size());
+        sg14::transform_subtract(lhs.data(), rhs.data(), difference.data(), difference.size());
+        for (auto i = 0; i!=array_size; ++i) {
+            EXPECT_EQ(rep_of(static_cast<Output>(lhs[i]+rhs[i])), rep_of(sum[i])) << "element " << i;
+            EXPECT_EQ(rep_of(static_cast<Output>(lhs[i]-rhs[i])), rep_of(difference[i])) << "element " << i;
+        }
+    }
+
+    template<class Output, class Lhs, class Rhs>
+    void expect_multiply(std::vector<Lhs> const& lhs, std::vector<Rhs> const& rhs)
+    {
+        std::vector<Output> product(lhs.size(), Output{0}), scaled(lhs.size(), Output{0});
+        sg14::transform_multiply(lhs.data(), rhs.data(), product.data(), product.size());
+        sg14::transform_scale(lhs.data(), rhs[0], scaled.data(), scaled.size());
+        for (auto i = 0; i!=array_size; ++i) {
+            EXPECT_EQ(rep_of(static_cast<Output>(lhs[i]*rhs[i])), rep_of(product[i])) << "element " << i;
+            EXPECT_EQ(rep_of(static_cast<Output>(lhs[i]*rhs[0])), rep_of(scaled[i])) << "element " << i;
+        }
+    }
+
+    // operands of 32 bits are kept small enough that the scalar operators do not overflow
+    template<class Rep, int Exponent>
+    void expect_arithmetic()
+    {
+        using type = fixed_point<Rep, Exponent>;
+        constexpr auto digits = std::numeric_limits<Rep>::digits;
+        constexpr auto sum_digits = (sizeof(Rep)<4) ? digits : digits-1;
+        constexpr auto factor_digits = (sizeof(Rep)<2) ? digits : 15;
+
+        expect_add<type>(random_array<type>(sum_digits), random_array<type>(sum_digits));
+
+        auto lhs = random_array<type>(factor_digits);
+        auto rhs = random_array<type>(factor_digits);
+        expect_multiply<type>(lhs, rhs);
+
+        // products shifted not at all or left
+        using unshifted_type = fixed_point<Rep, Exponent*2>;
+        expect_multiply<unshifted_type>(lhs, rhs);
+        using left_type = fixed_point<Rep, Exponent*2-3>;
+        expect_multiply<left_type>(random_array<type>(factor_digits-2), random_array<type>(factor_digits-2));
+    }
+}
+
+TEST(fixed_point_array, int8)
+{
+    expect_arithmetic<std::int8_t, -5>();
+}
+
+TEST(fixed_point_array, uint8)
+{
+    expect_arithmetic<std::uint8_t, -7>();
+}
+
+TEST(fixed_point_array, int16)
+{
+    expect_arithmetic<std::int16_t, -15>();
+}
+
+TEST(fixed_point_array, uint16)
+{
+    expect_arithmetic<std::uint16_t, -8>();
+}
+
+TEST(fixed_point_array, int32)
+{
+    expect_arithmetic<std::int32_t, -12>();
+}
+
+TEST(fixed_point_array, uint32)
+{
+    expect_arithmetic<std::uint32_t, -4>();
+}
+
+TEST(fixed_point_array, scalar)
+{
+    // types for which there is no kernel are calculated by the scalar operators
+    using q7 = fixed_point<std::int8_t, -7>;
+    using q15 = fixed_point<std::int16_t, -15>;
+    auto narrow = random_array<q7>();
+    auto wide = random_array<q15>();
+    expect_add<q15>(narrow, wide);
+    expect_add<fixed_point<std::int64_t, -20>>(random_array<fixed_point<std::int64_t, -20>>(40),
+            random_array<fixed_point<std::int64_t, -20>>(40));
+    expect_multiply<fixed_point<std::int32_t, -22>>(narrow, wide);
+
+    // products shifted by more places than the kernels can
+    expect_multiply<fixed_point<std::int16_t, 2>>(wide, wide);
+
+    using saturated = fixed_point<sg14::safe_integer<std::int16_t, sg14::saturated_overflow_tag>, -8>;
+    auto a = std::vector<saturated>{saturated{100}, saturated{-.5}, saturated{3}};
+    auto b = std::vector<saturated>{saturated{100}, saturated{-100}, saturated{.25}};
+    auto c = a;
+    sg14::transform_add(a.data(), b.data(), c.data(), c.size());
+    EXPECT_EQ(saturated{std::numeric_limits<saturated>::max()}, c[0]);
+    EXPECT_EQ(saturated{-100.5}, c[1]);
+    EXPECT_EQ(saturated{3.25}, c[2]);
+}
+
+TEST(fixed_point_array, in_place)
+{
+    using q15 = fixed_point<std::int16_t, -15>;
+    auto values = random_array<q15>();
+    auto expected = values;
+    for (auto& value : expected) {
+        value = static_cast<q15>(value*value);
+    }
+
+    sg14::transform_multiply(values.data(), values.data(), values.data(), values.size());
+    for (auto i = 0; i!=array_size; ++i) {
+        EXPECT_EQ(rep_of(expected[i]), rep_of(values[i])) << "element " << i;
+    }
+}
+
+TEST(fixed_point_array, simd_level)
+{
+    // each level calculates the same results, a register at a time, up to the level which the processor supports
+    using q15 = fixed_point<std::int16_t, -15>;
+    auto const lhs = random_array<q15>();
+    auto const rhs = random_array<q15>();
+    auto output = lhs;
+
+    auto const initial = sg14::get_simd_level();
+    auto const detected = sg14::detected_simd_level();
+    for (auto level : {simd_level::none, simd_level::sse2, simd_level::sse41, simd_level::avx2, simd_level::avx512}) {
+        auto selected = sg14::set_simd_level(level);
+        EXPECT_EQ((level<detected) ? level : detected, selected);
+        EXPECT_EQ(selected, sg14::get_simd_level());
+
+        auto register_bytes = (selected==simd_level::none) ? 0
+                : (selected==simd_level::avx512) ? 64
+                : (selected==simd_level::avx2) ? 32
+                : 16;
+        auto lanes = register_bytes/2;
+        auto expected_count = (lanes==0) ? 0 : array_size-array_size%lanes;
+        EXPECT_EQ(expected_count, static_cast<int>(sg14::_impl::fp::simd::multiply_vectors(
+                lhs.data(), rhs.data(), output.data(), output.size())));
+
+        expect_arithmetic<std::int8_t, -5>();
+        expect_arithmetic<std::uint8_t, -7>();
+        expect_arithmetic<std::int16_t, -15>();
+        expect_arithmetic<std::uint16_t, -8>();
+        expect_arithmetic<std::int32_t, -12>();
+        expect_arithmetic<std::uint32_t, -4>();
+    }
+    sg14::set_simd_level(initial);
+
+    // names of levels are as given to environment variable, SG14_SIMD_LEVEL
+    using sg14::_impl::fp::simd::parse_simd_level;
+    EXPECT_EQ(simd_level::sse41, parse_simd_level("sse4.1", simd_level::avx2));
+    EXPECT_EQ(simd_level::none, parse_simd_level("none", simd_level::avx2));
+    EXPECT_EQ(simd_level::avx2, parse_simd_level("avx", simd_level::avx2));
+    EXPECT_EQ(simd_level::avx2, parse_simd_level(nullptr, simd_level::avx2));
+}
+
+TEST(fixed_point_array, saturated)
+{
+    // signed 8- and 16-bit saturated results agree with those of the scalar operators at every level
+    using q7 = fixed_point<sg14::safe_integer<std::int8_t, sg14::saturated_overflow_tag>, -7>;
+    using q15 = fixed_point<sg14::safe_integer<std::int16_t, sg14::saturated_overflow_tag>, -15>;
+    using q3_12 = fixed_point<sg14::safe_integer<std::int16_t, sg14::saturated_overflow_tag>, -12>;
+
+    auto const initial = sg14::get_simd_level();
+    for (auto level : {simd_level::none, simd_level::sse2, simd_level::sse41, simd_level::avx2, simd_level::avx512}) {
+        sg14::set_simd_level(level);
+
+        // the most negative values square to one, which saturates
+        auto narrow = random_array<q7>();
+        narrow[0] = q7::from_data(-128);
+        expect_add<q7>(narrow, random_array<q7>());
+        expect_multiply<q7>(narrow, narrow);
+
+        auto wide = random_array<q15>();
+        wide[0] = q15::from_data(-32768);
+        expect_add<q15>(wide, random_array<q15>());
+        expect_multiply<q15>(wide, wide);
+        expect_multiply<q15>(wide, random_array<q15>());
+        expect_multiply<q3_12>(wide, random_array<q15>());
+    }
+    sg14::set_simd_level(initial);
+
+    // unless the level is none, products of saturated reps are calculated by the kernels
+    auto lhs = random_array<q15>();
+    auto output = lhs;
+    auto count = sg14::_impl::fp::simd::multiply_vectors(lhs.data(), lhs.data(), output.data(), output.size());
+    EXPECT_EQ(sg14::get_simd_level()!=simd_level::none, count!=0);
+}
@@ -0,0 +1,83 @@
+
+//          Copyright John McFarlane 2015 - 2016.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sg14/fixed_point>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <random>
+
+using sg14::fixed_point;
+using sg14::fixed_divisor;
+
+namespace {
+    using s15_16 = fixed_point<std::int32_t, -16>;
+    using s31_32 = fixed_point<std::int64_t, -32>;
+
+    constexpr auto three = fixed_divisor<s15_16>{s15_16{3}};
+    constexpr auto minus_quarter = fixed_divisor<fixed_point<std::int8_t, -4>>{fixed_point<std::int8_t, -4>{-.25}};
+    constexpr auto zero = fixed_divisor<s15_16>{s15_16{0}};
+}
+
+// divisors are prepared and applied at compile time
+static_assert(three.value()==3, "sg14::fixed_divisor test failed");
+static_assert(s15_16{1}/three==s15_16::from_data(21845), "sg14::fixed_divisor test failed");
+static_assert(s15_16{-1}/three==s15_16::from_data(-21845), "sg14::fixed_divisor test failed");
+static_assert(s31_32{12}/three==4, "sg14::fixed_divisor test failed");
+static_assert(s15_16{3}/minus_quarter==-12, "sg14::fixed_divisor test failed");
+
+// the result type can be chosen
+static_assert(sg14::divide<fixed_point<std::int64_t, -40>>(sg14::fast_reciprocal, s15_16{1}, three)
+        ==fixed_point<std::int64_t, -40>::from_data(366503875925), "sg14::fixed_divisor test failed");
+static_assert(std::is_same<decltype(divide(sg14::fast_reciprocal, s31_32{}, three)), s31_32>::value,
+        "sg14::fixed_divisor test failed");
+
+// results which cannot be represented saturate
+static_assert(fixed_point<std::int8_t, -4>{-4}/minus_quarter==std::numeric_limits<fixed_point<std::int8_t, -4>>::max(),
+        "sg14::fixed_divisor test failed");
+static_assert(s15_16{1}/zero==std::numeric_limits<s15_16>::max(), "sg14::fixed_divisor test failed");
+static_assert(s15_16{-1}/zero==std::numeric_limits<s15_16>::lowest(), "sg14::fixed_divisor test failed");
+
+// division by fixed_divisor matches division by reciprocal of the divisor
+template<class Output, class Lhs, class Rhs>
+void test_fixed_divisor()
+{
+    std::mt19937_64 generator;
+    for (int divisor_index = 0; divisor_index!=100; ++divisor_index) {
+        auto rhs = Rhs::from_data(static_cast<typename Rhs::rep>(generator() >> (generator()%64)));
+        auto divisor = fixed_divisor<Rhs>{rhs};
+        for (int dividend_index = 0; dividend_index!=1000; ++dividend_index) {
+            auto lhs = Lhs::from_data(static_cast<typename Lhs::rep>(generator() >> (generator()%64)));
+            auto expected = sg14::divide<Output>(sg14::fast_reciprocal, lhs, rhs);
+            auto actual = sg14::divide<Output>(sg14::fast_reciprocal, lhs, divisor);
+            EXPECT_EQ(expected, actual) << "divide fail at " << lhs << " / " << rhs;
+        }
+    }
+}
+
+TEST(fixed_divisor, formats)
+{
+    test_fixed_divisor<s15_16, s15_16, s15_16>();
+    test_fixed_divisor<s31_32, s31_32, s31_32>();
+    test_fixed_divisor<fixed_point<std::uint8_t, -4>, fixed_point<std::int8_t, -7>, fixed_point<std::int8_t, -7>>();
+    test_fixed_divisor<fixed_point<std::int16_t, 4>, s15_16, fixed_point<std::uint32_t, -24>>();
+    test_fixed_divisor<fixed_point<std::uint64_t, -40>, fixed_point<std::uint64_t, -60>, fixed_point<std::uint64_t, -4>>();
+}
+
+TEST(fixed_divisor, normalize)
+{
+    std::array<s15_16, 5> samples{{s15_16{1}, s15_16{-2.5}, s15_16{7}, s15_16{0}, s15_16{100}}};
+    auto gain = fixed_divisor<s15_16>{s15_16{2.5}};
+    for (auto& sample : samples) {
+        sample = sample/gain;
+    }
+    EXPECT_EQ(s15_16{.4}, samples[0]);
+    EXPECT_EQ(s15_16{-1}, samples[1]);
+    EXPECT_EQ(s15_16{2.8}, samples[2]);
+    EXPECT_EQ(s15_16{0}, samples[3]);
+    EXPECT_EQ(s15_16{40}, samples[4]);
+}
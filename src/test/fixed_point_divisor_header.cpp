@@ -0,0 +1,10 @@
+//          Copyright John McFarlane 2015 - 2016.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// sg14/bits/fixed_point_divisor.h compiles without first including sg14/fixed_point
+#include <sg14/bits/fixed_point_divisor.h>
+
+static_assert(sg14::fixed_point<std::int32_t, -16>{12}/sg14::fixed_divisor<sg14::fixed_point<std::int32_t, -16>>{
+        sg14::fixed_point<std::int32_t, -16>{3}}==4, "sg14/bits/fixed_point_divisor.h test failed");
@@ -0,0 +1,90 @@
+
+//          Copyright John McFarlane 2015 - 2016.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sg14/fixed_point>
+
+#include <gtest/gtest.h>
+
+using sg14::fixed_point;
+using sg14::fixed_point_lut;
+
+namespace {
+    using sin_input = fixed_point<std::int16_t, -12>;
+    using sin_output = fixed_point<std::int32_t, -28>;
+
+    // fixed-point results are sampled at the precision of the output
+    struct sin_function {
+        constexpr sin_output operator()(sin_input x) const { return sin(sin_output{x}); }
+    };
+
+    // floating-point results are rounded to nearest
+    struct cube_function {
+        constexpr double operator()(fixed_point<std::int8_t, -4> x) const {
+            return static_cast<double>(x)*static_cast<double>(x)*static_cast<double>(x)/8.;
+        }
+    };
+
+    using sin_linear = fixed_point_lut<sin_function, sin_input, sin_output, 8>;
+    using sin_quadratic = fixed_point_lut<sin_function, sin_input, sin_output, 6, sg14::quadratic_interpolation_tag>;
+
+    struct square_function {
+        constexpr double operator()(fixed_point<std::int8_t, -4> x) const {
+            return static_cast<double>(x)*static_cast<double>(x)/8.;
+        }
+    };
+
+    using cube_input = fixed_point<std::int8_t, -4>;
+    using cube_linear = fixed_point_lut<cube_function, cube_input, fixed_point<std::int16_t, -8>, 4>;
+    using cube_quadratic = fixed_point_lut<cube_function, cube_input, fixed_point<std::int16_t, -8>, 2,
+            sg14::quadratic_interpolation_tag>;
+    using square_quadratic = fixed_point_lut<square_function, cube_input, fixed_point<std::int16_t, -8>, 2,
+            sg14::quadratic_interpolation_tag>;
+}
+
+// tables are generated and evaluated at compile time
+static_assert(sin_linear::size==257, "sg14::fixed_point_lut test failed");
+static_assert(sin_quadratic::size==129, "sg14::fixed_point_lut test failed");
+static_assert(sin_linear::evaluate(sin_input{0})==0, "sg14::fixed_point_lut test failed");
+static_assert(sin_linear{}(sin_input{-8})==sin(sin_output{-8}), "sg14::fixed_point_lut test failed");
+
+// samples are exact at the ends of each segment
+static_assert(cube_linear::evaluate(cube_input{-8})==-64, "sg14::fixed_point_lut test failed");
+static_assert(cube_linear::evaluate(cube_input{2})==1, "sg14::fixed_point_lut test failed");
+static_assert(cube_linear::evaluate(cube_input{1.5})==.5625, "sg14::fixed_point_lut test failed");
+
+// a parabola through each segment reproduces a quadratic exactly
+static_assert(square_quadratic::evaluate(cube_input{1.5})==.28125, "sg14::fixed_point_lut test failed");
+static_assert(square_quadratic::evaluate(cube_input{-7.5})==7.03125, "sg14::fixed_point_lut test failed");
+
+template<class Lut, class Reference>
+void test_lut(Reference reference, double tolerance)
+{
+    using input_type = typename Lut::input_type;
+    using output_type = typename Lut::output_type;
+    auto lsb = static_cast<double>(std::numeric_limits<output_type>::min());
+    for (auto data = static_cast<int>(std::numeric_limits<input_type>::lowest().data());
+         data<=static_cast<int>(std::numeric_limits<input_type>::max().data()); ++data) {
+        auto input = input_type::from_data(static_cast<typename input_type::rep>(data));
+        auto expected = reference(static_cast<double>(input));
+        auto actual = Lut::evaluate(input);
+        EXPECT_LE(std::abs(static_cast<double>(actual)-expected)/lsb, tolerance)
+                << "input: " << input << ", actual: " << actual << ", expected: " << expected;
+    }
+}
+
+TEST(fixed_point_lut, linear)
+{
+    // error of linear interpolation is bounded by h^2/8 * max|f''| plus the error in the samples
+    test_lut<sin_linear>([](double x) { return std::sin(x); }, std::exp2(28)*std::pow(16./256, 2)/8+2);
+    test_lut<cube_linear>([](double x) { return x*x*x/8; }, std::exp2(8)*std::pow(16./16, 2)/8*6+1);
+}
+
+TEST(fixed_point_lut, quadratic)
+{
+    // error of quadratic interpolation is bounded by h^3/(9*sqrt(3)) * max|f'''| where h is half a segment
+    test_lut<sin_quadratic>([](double x) { return std::sin(x); }, std::exp2(28)*std::pow(8./64, 3)/(9*std::sqrt(3.))+2);
+    test_lut<cube_quadratic>([](double x) { return x*x*x/8; }, std::exp2(8)*std::pow(8./4, 3)/(9*std::sqrt(3.))*.75+1);
+}
@@ -0,0 +1,17 @@
+//          Copyright John McFarlane 2015 - 2016.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// sg14/bits/fixed_point_lut.h compiles without first including sg14/fixed_point
+#include <sg14/bits/fixed_point_lut.h>
+
+namespace {
+    struct identity_function {
+        constexpr sg14::fixed_point<std::int8_t, -4> operator()(sg14::fixed_point<std::int8_t, -4> x) const { return x; }
+    };
+}
+
+static_assert(sg14::fixed_point_lut<identity_function, sg14::fixed_point<std::int8_t, -4>,
+        sg14::fixed_point<std::int8_t, -4>, 4>::evaluate(sg14::fixed_point<std::int8_t, -4>{1.5})==1.5,
+        "sg14/bits/fixed_point_lut.h test failed");
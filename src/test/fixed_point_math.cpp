@@ -6,12 +6,424 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
+
 #include <sg14/fixed_point>
 #include <sg14/bits/fixed_point_math.h>
 
+//Calculates the error in a result, in units of the least significant bit
+template<class FixedPoint>
+double error_in_lsb(FixedPoint result, double expected)
+{
+    return std::abs(static_cast<double>(result) - expected) / static_cast<double>(std::numeric_limits<FixedPoint>::min());
+}
+
+//Checks whether a value can be represented by a fixed-point type
+template<class FixedPoint>
+bool is_representable(double value)
+{
+    return value < static_cast<double>(std::numeric_limits<FixedPoint>::max())
+            && value > static_cast<double>(std::numeric_limits<FixedPoint>::lowest());
+}
+
 //Fails due to cast being out-of-range:
 #include "fixed_point_math_Q0.cpp"
 #include "fixed_point_math_Q1.cpp"
 #include "fixed_point_math_Q15.cpp"
 #include "fixed_point_math_Q31.cpp"
 
+
+//Polynomials evaluate identically by Horner's method and Estrin's scheme
+namespace polynomial_test {
+    using sg14::_impl::fp::evaluate_polynomial;
+    using sg14::_impl::fp::estrin_scheme;
+    using sg14::_impl::fp::horner_scheme;
+
+    // 1 + 2x + 3x^2 - 4x^3 + 5x^4
+    using quartic = sg14::_impl::fp::polynomial<4, 16, 32, 48, -64, 80>;
+    using fp = sg14::fixed_point<int32_t, -16>;
+
+    static_assert(evaluate_polynomial<quartic, horner_scheme>(fp{.5}) == 2.5625, "sg14::evaluate_polynomial test failed");
+    static_assert(evaluate_polynomial<quartic, estrin_scheme>(fp{.5}) == 2.5625, "sg14::evaluate_polynomial test failed");
+    static_assert(evaluate_polynomial<quartic, horner_scheme>(fp{-2}) == 121, "sg14::evaluate_polynomial test failed");
+    static_assert(evaluate_polynomial<quartic, estrin_scheme>(fp{-2}) == 121, "sg14::evaluate_polynomial test failed");
+    static_assert(evaluate_polynomial<sg14::_impl::fp::polynomial<0, 7>>(fp{3}) == 7, "sg14::evaluate_polynomial test failed");
+}
+
+//The degree of the exp2 polynomial follows the digits of the fractional part
+static_assert(sg14::_impl::fp::exp2_degree(8) == 3, "sg14::exp2 test failed");
+static_assert(sg14::_impl::fp::exp2_degree(16) == 4, "sg14::exp2 test failed");
+static_assert(sg14::_impl::fp::exp2_degree(32) == 7, "sg14::exp2 test failed");
+static_assert(sg14::_impl::fp::exp2_degree(64) == 12, "sg14::exp2 test failed");
+static_assert(exp2(sg14::fixed_point<uint32_t, -28>{3.5}) == 11.313708499073982, "sg14::exp2 test failed");
+
+//Narrow types are tested exhaustively
+template<class FixedPoint>
+void test_exp2_exhaustive()
+{
+    using rep = typename FixedPoint::rep;
+    for (auto data = std::numeric_limits<rep>::lowest(); ; ++data) {
+        auto x = FixedPoint::from_data(data);
+        auto expected = std::exp2(static_cast<double>(x));
+        if (is_representable<FixedPoint>(expected)) {
+            EXPECT_LE(std::abs(exp2(x).data() - FixedPoint{ expected }.data()), 1)
+                << "exp2 fail at " << x << ", fixed point raw: " << exp2(x).data();
+        }
+        if (data == std::numeric_limits<rep>::max()) {
+            break;
+        }
+    }
+}
+
+TEST(math, exhaustive) {
+    test_exp2_exhaustive<sg14::fixed_point<int8_t, -4>>();
+    test_exp2_exhaustive<sg14::fixed_point<uint8_t, -5>>();
+    test_exp2_exhaustive<sg14::fixed_point<int8_t, -7>>();
+    test_exp2_exhaustive<sg14::fixed_point<int16_t, -8>>();
+    test_exp2_exhaustive<sg14::fixed_point<uint16_t, -12>>();
+    test_exp2_exhaustive<sg14::fixed_point<int16_t, -15>>();
+}
+
+//Exponential and logarithmic functions are constexpr
+static_assert(exp(sg14::fixed_point<int32_t, -16>{0}) == 1, "sg14::exp test failed");
+static_assert(exp10(sg14::fixed_point<int32_t, -16>{2}) == 100, "sg14::exp10 test failed");
+static_assert(log2(sg14::fixed_point<int32_t, -16>{8}) == 3, "sg14::log2 test failed");
+static_assert(log2(sg14::fixed_point<uint8_t, -4>{4}) == 2, "sg14::log2 test failed");
+static_assert(log(sg14::fixed_point<int32_t, -16>{1}) == 0, "sg14::log test failed");
+
+//Results which are out of range saturate
+static_assert(log(sg14::fixed_point<int16_t, -15>{.25}) == std::numeric_limits<sg14::fixed_point<int16_t, -15>>::lowest(),
+        "sg14::log test failed");
+static_assert(log(sg14::fixed_point<int16_t, -15>{.1}) == std::numeric_limits<sg14::fixed_point<int16_t, -15>>::lowest(),
+        "sg14::log test failed");
+static_assert(log2(sg14::fixed_point<int16_t, -12>::from_data(1)) == std::numeric_limits<sg14::fixed_point<int16_t, -12>>::lowest(),
+        "sg14::log2 test failed");
+static_assert(log2(sg14::fixed_point<uint8_t, -8>{.25}) == 0, "sg14::log2 test failed");
+#if !defined(SG14_EXCEPTIONS_ENABLED)
+static_assert(log2(sg14::fixed_point<int32_t, -16>{0}) == std::numeric_limits<sg14::fixed_point<int32_t, -16>>::lowest(),
+        "sg14::log2 test failed");
+static_assert(log(sg14::fixed_point<int32_t, -16>{-1}) == std::numeric_limits<sg14::fixed_point<int32_t, -16>>::lowest(),
+        "sg14::log test failed");
+#endif
+static_assert(exp2(sg14::fixed_point<int32_t, -16>{-17}) == 0, "sg14::exp2 test failed");
+static_assert(exp2(sg14::fixed_point<int32_t, -16>{-16.5}) == sg14::fixed_point<int32_t, -16>::from_data(1),
+        "sg14::exp2 test failed");
+#if defined(SG14_INT128_ENABLED)
+static_assert(exp(sg14::fixed_point<int64_t, -16>{5e9}) == std::numeric_limits<sg14::fixed_point<int64_t, -16>>::max(),
+        "sg14::exp test failed");
+static_assert(exp(std::numeric_limits<sg14::fixed_point<int64_t, -16>>::max())
+        == std::numeric_limits<sg14::fixed_point<int64_t, -16>>::max(), "sg14::exp test failed");
+static_assert(exp(std::numeric_limits<sg14::fixed_point<int64_t, -16>>::lowest()) == 0, "sg14::exp test failed");
+static_assert(exp10(std::numeric_limits<sg14::fixed_point<int64_t, -16>>::max())
+        == std::numeric_limits<sg14::fixed_point<int64_t, -16>>::max(), "sg14::exp10 test failed");
+static_assert(exp10(std::numeric_limits<sg14::fixed_point<int64_t, -16>>::lowest()) == 0, "sg14::exp10 test failed");
+static_assert(exp2(sg14::fixed_point<int64_t, -16>{-3e9}) == 0, "sg14::exp2 test failed");
+static_assert(exp2(std::numeric_limits<sg14::fixed_point<int64_t, -16>>::max())
+        == std::numeric_limits<sg14::fixed_point<int64_t, -16>>::max(), "sg14::exp2 test failed");
+static_assert(exp2(std::numeric_limits<sg14::fixed_point<int64_t, -16>>::lowest()) == 0, "sg14::exp2 test failed");
+static_assert(exp2(std::numeric_limits<sg14::fixed_point<int64_t, 8>>::max())
+        == std::numeric_limits<sg14::fixed_point<int64_t, 8>>::max(), "sg14::exp2 test failed");
+static_assert(exp2(sg14::fixed_point<int64_t, 8>{256}) == std::numeric_limits<sg14::fixed_point<int64_t, 8>>::max(),
+        "sg14::exp2 test failed");
+#endif
+
+//Reciprocal square root is constexpr and can produce a different format from its input
+static_assert(rsqrt(sg14::fixed_point<int32_t, -16>{4}) == .5, "sg14::rsqrt test failed");
+static_assert(sg14::rsqrt<sg14::fixed_point<uint8_t, -7>>(sg14::fixed_point<int32_t, -16>{16384}) == .0078125,
+        "sg14::rsqrt test failed");
+static_assert(sg14::rsqrt<sg14::fixed_point<int16_t, -4>>(sg14::fixed_point<uint8_t, -8>{0.}) == 2047.9375,
+        "sg14::rsqrt test failed");
+
+template<class Output, class Input>
+void test_rsqrt(double first, double last)
+{
+    //Results of 64-bit formats are compared against long double where it is more precise than double
+    using reference = long double;
+    for (int i = 0; i <= 1000; i++) {
+        Input x{ first * std::pow(last / first, i / 1000.) };
+        auto expected = reference{ 1 } / std::sqrt(static_cast<reference>(x));
+        if (x > Input{ 0 } && expected < static_cast<reference>(std::numeric_limits<Output>::max())) {
+            auto actual = sg14::rsqrt<Output>(x);
+            auto error = std::abs(static_cast<reference>(actual) - expected)
+                    / static_cast<reference>(std::numeric_limits<Output>::min());
+            EXPECT_LE(error, 1.)
+                << "rsqrt fail at " << x << ", fixed point raw: " << actual.data();
+        }
+    }
+}
+
+TEST(math_rsqrt, formats) {
+    test_rsqrt<sg14::fixed_point<uint8_t, -7>, sg14::fixed_point<uint8_t, -4>>(.0625, 15.9375);
+    test_rsqrt<sg14::fixed_point<int16_t, -14>, sg14::fixed_point<int16_t, -8>>(.5, 127.);
+    test_rsqrt<sg14::fixed_point<int32_t, -30>, sg14::fixed_point<int32_t, -16>>(1., 32767.);
+    test_rsqrt<sg14::fixed_point<uint32_t, -20>, sg14::fixed_point<int64_t, -32>>(1e-6, 2e9);
+    if (std::numeric_limits<long double>::digits >= 64) {
+        test_rsqrt<sg14::fixed_point<int64_t, -48>, sg14::fixed_point<int64_t, -48>>(2e-5, 32000.);
+        test_rsqrt<sg14::fixed_point<uint64_t, -56>, sg14::fixed_point<uint64_t, 0>>(1., 1.8e19);
+    }
+}
+
+TEST(math_rsqrt, normalize) {
+    using component = sg14::fixed_point<int32_t, -16>;
+    auto x = component{ 3 }, y = component{ -4 }, z = component{ 12 };
+    auto scale = sg14::rsqrt<sg14::fixed_point<int32_t, -30>>(
+            sg14::multiply(x, x) + sg14::multiply(y, y) + sg14::multiply(z, z));
+
+    EXPECT_NEAR(static_cast<double>(component{ sg14::multiply(x, scale) }), 3. / 13, 1. / 65536);
+    EXPECT_NEAR(static_cast<double>(component{ sg14::multiply(y, scale) }), -4. / 13, 1. / 65536);
+    EXPECT_NEAR(static_cast<double>(component{ sg14::multiply(z, scale) }), 12. / 13, 1. / 65536);
+}
+
+//Functions of two coordinates
+static_assert(atan2(sg14::fixed_point<int32_t, -16>{0}, sg14::fixed_point<int32_t, -16>{0}) == 0, "sg14::atan2 test failed");
+static_assert(atan2(sg14::fixed_point<int32_t, -16>{2}, sg14::fixed_point<int32_t, -16>{2})
+        == atan(sg14::fixed_point<int32_t, -16>{1}), "sg14::atan2 test failed");
+static_assert(atan2(sg14::fixed_point<int32_t, -16>{0}, sg14::fixed_point<int32_t, -16>{-3}) > 3.14157
+        && atan2(sg14::fixed_point<int32_t, -16>{0}, sg14::fixed_point<int32_t, -16>{-3}) < 3.14161,
+        "sg14::atan2 test failed");
+static_assert(hypot(sg14::fixed_point<int32_t, -16>{3}, sg14::fixed_point<int32_t, -16>{-4}) == 5, "sg14::hypot test failed");
+//the lowest value of a 64-bit representation is negated without overflow
+static_assert(atan2(sg14::fixed_point<int64_t, -60>{0}, std::numeric_limits<sg14::fixed_point<int64_t, -60>>::lowest()) > 3.14159265
+        && atan2(sg14::fixed_point<int64_t, -60>{0}, std::numeric_limits<sg14::fixed_point<int64_t, -60>>::lowest()) < 3.14159266,
+        "sg14::atan2 test failed");
+static_assert(atan2(std::numeric_limits<sg14::fixed_point<int64_t, -60>>::lowest(),
+        std::numeric_limits<sg14::fixed_point<int64_t, -60>>::lowest()) > -2.35619450
+        && atan2(std::numeric_limits<sg14::fixed_point<int64_t, -60>>::lowest(),
+                std::numeric_limits<sg14::fixed_point<int64_t, -60>>::lowest()) < -2.35619449,
+        "sg14::atan2 test failed");
+static_assert(hypot(std::numeric_limits<sg14::fixed_point<int64_t, -60>>::lowest(), sg14::fixed_point<int64_t, -60>{0})
+        == std::numeric_limits<sg14::fixed_point<int64_t, -60>>::max(), "sg14::hypot test failed");
+static_assert(hypot(sg14::fixed_point<int64_t, -32>{-1073741824}, sg14::fixed_point<int64_t, -32>{-1073741824}) > 1518500249.98
+        && hypot(sg14::fixed_point<int64_t, -32>{-1073741824}, sg14::fixed_point<int64_t, -32>{-1073741824}) < 1518500249.99,
+        "sg14::hypot test failed");
+static_assert(hypot(sg14::fixed_point<int16_t, -8>{100}, sg14::fixed_point<int16_t, -8>{100})
+        == std::numeric_limits<sg14::fixed_point<int16_t, -8>>::max(), "sg14::hypot test failed");
+
+template<class FixedPoint>
+void test_two_coordinates(double range)
+{
+    using reference = long double;
+    auto lsb = static_cast<reference>(std::numeric_limits<FixedPoint>::min());
+    for (int i = 0; i <= 100; i++) {
+        for (int j = 0; j <= 100; j++) {
+            FixedPoint x{ range * (i - 50) / 50 };
+            FixedPoint y{ range * (j - 50) / 50 * ((i + j) % 3 ? 1 : 1e-3) };
+
+            auto expected_angle = std::atan2(static_cast<reference>(y), static_cast<reference>(x));
+            EXPECT_LE(std::abs(static_cast<reference>(atan2(y, x)) - expected_angle) / lsb, 1.)
+                << "atan2 fail at " << y << ", " << x << ", fixed point raw: " << atan2(y, x).data();
+
+            auto expected_magnitude = std::hypot(static_cast<reference>(x), static_cast<reference>(y));
+            if (expected_magnitude < static_cast<reference>(std::numeric_limits<FixedPoint>::max())) {
+                EXPECT_LE(std::abs(static_cast<reference>(hypot(x, y)) - expected_magnitude) / lsb, 1.)
+                    << "hypot fail at " << x << ", " << y << ", fixed point raw: " << hypot(x, y).data();
+            }
+        }
+    }
+}
+
+TEST(math_atan2_hypot, formats) {
+    test_two_coordinates<sg14::fixed_point<int8_t, -4>>(5.);
+    test_two_coordinates<sg14::fixed_point<int16_t, -8>>(90.);
+    test_two_coordinates<sg14::fixed_point<int32_t, -16>>(20000.);
+    test_two_coordinates<sg14::fixed_point<int32_t, -29>>(2.);
+    if (std::numeric_limits<long double>::digits >= 64) {
+        test_two_coordinates<sg14::fixed_point<int64_t, -32>>(1e6);
+    }
+}
+
+//Powers are constexpr; integer powers known at compile time are exact
+static_assert(sg14::pow<3>(sg14::fixed_point<int16_t, -8>{-1.5}) == -3.375, "sg14::pow test failed");
+static_assert(std::is_same<decltype(sg14::pow<3>(sg14::fixed_point<int16_t, -8>{})),
+        sg14::fixed_point<int64_t, -24>>::value, "sg14::pow test failed");
+static_assert(pow(sg14::fixed_point<int32_t, -16>{3}, 4) == 81, "sg14::pow test failed");
+static_assert(pow(sg14::fixed_point<int32_t, -16>{-2}, -3) == -.125, "sg14::pow test failed");
+static_assert(pow(sg14::fixed_point<int32_t, -16>{0}, -1) == std::numeric_limits<sg14::fixed_point<int32_t, -16>>::max(),
+        "sg14::pow test failed");
+static_assert(pow(sg14::fixed_point<int32_t, -16>{5}, 0) == 1, "sg14::pow test failed");
+static_assert(pow(sg14::fixed_point<int16_t, -8>{16}, 3) == std::numeric_limits<sg14::fixed_point<int16_t, -8>>::max(),
+        "sg14::pow test failed");
+static_assert(pow(sg14::fixed_point<int16_t, -8>{-16}, 3) == std::numeric_limits<sg14::fixed_point<int16_t, -8>>::lowest(),
+        "sg14::pow test failed");
+static_assert(pow(sg14::fixed_point<int16_t, -8>{-16}, 4) == std::numeric_limits<sg14::fixed_point<int16_t, -8>>::max(),
+        "sg14::pow test failed");
+static_assert(pow(sg14::fixed_point<int16_t, -8>{.0625}, -3) == std::numeric_limits<sg14::fixed_point<int16_t, -8>>::max(),
+        "sg14::pow test failed");
+static_assert(pow(sg14::fixed_point<int32_t, 4>{1024}, 5) == std::numeric_limits<sg14::fixed_point<int32_t, 4>>::max(),
+        "sg14::pow test failed");
+static_assert(pow(sg14::fixed_point<uint8_t, -4>{4}, 2) == std::numeric_limits<sg14::fixed_point<uint8_t, -4>>::max(),
+        "sg14::pow test failed");
+static_assert(pow(sg14::fixed_point<int32_t, -16>{4}, sg14::fixed_point<int32_t, -16>{1.5}) == 8, "sg14::pow test failed");
+static_assert(pow(sg14::fixed_point<int32_t, -16>{-2}, sg14::fixed_point<int8_t, 0>{3}) == -8, "sg14::pow test failed");
+static_assert(pow(sg14::fixed_point<int32_t, -16>{0}, sg14::fixed_point<int32_t, -16>{.5}) == 0, "sg14::pow test failed");
+
+template<class FixedPoint>
+void test_pow(double first, double last)
+{
+    using reference = long double;
+    auto lsb = static_cast<reference>(std::numeric_limits<FixedPoint>::min());
+    for (int i = 0; i <= 100; i++) {
+        FixedPoint x{ first + (last - first) * i / 100 };
+        if (x <= FixedPoint{ 0 }) {
+            continue;
+        }
+
+        for (int j = -40; j <= 40; j++) {
+            FixedPoint y{ j / 8. };
+            auto expected = std::pow(static_cast<reference>(x), static_cast<reference>(y));
+            if (expected < static_cast<reference>(std::numeric_limits<FixedPoint>::max())) {
+                EXPECT_LE(std::abs(static_cast<reference>(pow(x, y)) - expected) / lsb, 2.)
+                    << "pow fail at " << x << ", " << y << ", fixed point raw: " << pow(x, y).data();
+            }
+        }
+
+        //each rounded product contributes up to half an LSB;
+        //the error in a reciprocal is magnified by the powers of it which follow
+        for (int n = -3; n <= 5; n++) {
+            auto expected = std::pow(static_cast<reference>(x), n);
+            auto magnification = std::max(reference{1}, std::pow(1 / static_cast<reference>(x), -n - 1));
+            auto tolerance = n < 0 ? 1 - n * magnification : std::max(n, 1);
+            if (expected < static_cast<reference>(std::numeric_limits<FixedPoint>::max())) {
+                EXPECT_LE(std::abs(static_cast<reference>(pow(x, n)) - expected) / lsb, tolerance)
+                    << "pow fail at " << x << ", " << n << ", fixed point raw: " << pow(x, n).data();
+            }
+        }
+    }
+}
+
+TEST(math_pow, formats) {
+    test_pow<sg14::fixed_point<int8_t, -4>>(0., 7.);
+    test_pow<sg14::fixed_point<uint16_t, -8>>(0., 200.);
+    test_pow<sg14::fixed_point<int32_t, -16>>(0., 1000.);
+    test_pow<sg14::fixed_point<int32_t, -28>>(0., 7.);
+}
+
+//Activation functions are constexpr and saturate at the ends of the range
+static_assert(sigmoid(sg14::fixed_point<int16_t, -15>{0}) == .5, "sg14::sigmoid test failed");
+static_assert(sigmoid(sg14::fixed_point<int16_t, -8>{100}) == 1, "sg14::sigmoid test failed");
+static_assert(sigmoid(sg14::fixed_point<int16_t, -15>{.99}) < 1, "sg14::sigmoid test failed");
+static_assert(sigmoid(sg14::fixed_point<int8_t, -7>{-1}) > sg14::fixed_point<int8_t, -7>{0}, "sg14::sigmoid test failed");
+static_assert(tanh(sg14::fixed_point<int32_t, -16>{0}) == 0, "sg14::tanh test failed");
+static_assert(tanh(sg14::fixed_point<int16_t, -15>{-1}) == -0.7615966796875, "sg14::tanh test failed");
+static_assert(tanh(sg14::fixed_point<int16_t, -8>{100}) == 1, "sg14::tanh test failed");
+static_assert(tanh(sg14::fixed_point<int8_t, -4>{-8}) == -1, "sg14::tanh test failed");
+static_assert(softplus(sg14::fixed_point<int16_t, -8>{100}) == 100, "sg14::softplus test failed");
+static_assert(softplus(sg14::fixed_point<int16_t, -8>{-100}) == 0, "sg14::softplus test failed");
+static_assert(softplus(sg14::fixed_point<int16_t, -14>{1.9}) == std::numeric_limits<sg14::fixed_point<int16_t, -14>>::max(),
+        "sg14::softplus test failed");
+#if defined(SG14_INT128_ENABLED)
+//e^-|x| is zero, not wrapped, at the ends of the range of 64-bit representations
+static_assert(sigmoid(sg14::fixed_point<int64_t, -16>{1e12}) == 1, "sg14::sigmoid test failed");
+static_assert(sigmoid(sg14::fixed_point<int64_t, -16>{-1e12}) == 0, "sg14::sigmoid test failed");
+static_assert(tanh(sg14::fixed_point<int64_t, -16>{1e12}) == 1, "sg14::tanh test failed");
+static_assert(tanh(sg14::fixed_point<int64_t, -16>{-1e14}) == -1, "sg14::tanh test failed");
+static_assert(sigmoid(std::numeric_limits<sg14::fixed_point<int64_t, -24>>::max()) == 1, "sg14::sigmoid test failed");
+static_assert(sigmoid(std::numeric_limits<sg14::fixed_point<int64_t, -24>>::lowest()) == 0, "sg14::sigmoid test failed");
+static_assert(tanh(std::numeric_limits<sg14::fixed_point<int64_t, -24>>::max()) == 1, "sg14::tanh test failed");
+static_assert(tanh(std::numeric_limits<sg14::fixed_point<int64_t, -24>>::lowest()) == -1, "sg14::tanh test failed");
+static_assert(softplus(std::numeric_limits<sg14::fixed_point<int64_t, -24>>::max())
+        == std::numeric_limits<sg14::fixed_point<int64_t, -24>>::max(), "sg14::softplus test failed");
+static_assert(softplus(std::numeric_limits<sg14::fixed_point<int64_t, -24>>::lowest()) == 0, "sg14::softplus test failed");
+#endif
+
+template<class FixedPoint>
+void test_activation(double range, double tolerance = 1.)
+{
+    using reference = long double;
+    auto lsb = static_cast<reference>(std::numeric_limits<FixedPoint>::min());
+    auto max = static_cast<reference>(std::numeric_limits<FixedPoint>::max());
+    auto lowest = static_cast<reference>(std::numeric_limits<FixedPoint>::lowest());
+    auto confine = [&](reference r) { return std::min(std::max(r, lowest), max); };
+
+    std::array<FixedPoint, 1001> inputs;
+    for (int i = 0; i <= 1000; i++) {
+        inputs[i] = FixedPoint{ range * (i - 500) / 500 };
+    }
+    std::array<FixedPoint, 1001> sigmoids, tanhs, softpluses;
+    sigmoid(inputs.data(), sigmoids.data(), inputs.size());
+    tanh(inputs.data(), tanhs.data(), inputs.size());
+    softplus(inputs.data(), softpluses.data(), inputs.size());
+
+    for (int i = 0; i <= 1000; i++) {
+        auto x = inputs[i];
+        auto xr = static_cast<reference>(x);
+
+        auto expected_sigmoid = confine(1 / (1 + std::exp(-xr)));
+        EXPECT_LE(std::abs(static_cast<reference>(sigmoid(x)) - expected_sigmoid) / lsb, tolerance)
+            << "sigmoid fail at " << x << ", fixed point raw: " << sigmoid(x).data();
+        EXPECT_EQ(sigmoids[i], sigmoid(x));
+
+        auto expected_tanh = confine(std::tanh(xr));
+        EXPECT_LE(std::abs(static_cast<reference>(tanh(x)) - expected_tanh) / lsb, tolerance)
+            << "tanh fail at " << x << ", fixed point raw: " << tanh(x).data();
+        EXPECT_EQ(tanhs[i], tanh(x));
+
+        auto expected_softplus = confine(std::max(xr, reference{0}) + std::log1p(std::exp(-std::abs(xr))));
+        EXPECT_LE(std::abs(static_cast<reference>(softplus(x)) - expected_softplus) / lsb, tolerance)
+            << "softplus fail at " << x << ", fixed point raw: " << softplus(x).data();
+        EXPECT_EQ(softpluses[i], softplus(x));
+    }
+}
+
+TEST(math_activation, formats) {
+    test_activation<sg14::fixed_point<int8_t, -7>>(1.);
+    test_activation<sg14::fixed_point<int8_t, -4>>(8.);
+    test_activation<sg14::fixed_point<int16_t, -15>>(1.);
+    test_activation<sg14::fixed_point<int16_t, -12>>(8.);
+    test_activation<sg14::fixed_point<uint16_t, -8>>(200.);
+    test_activation<sg14::fixed_point<int32_t, -16>>(30000.);
+    test_activation<sg14::fixed_point<int32_t, -31>>(1., 2.);
+    test_activation<sg14::fixed_point<int32_t, -24>>(100.);
+}
+
+//Division by reciprocal is constexpr, rounds toward zero and saturates
+static_assert(divide(sg14::fast_reciprocal, sg14::fixed_point<int64_t, -32>{3}, sg14::fixed_point<int64_t, -32>{4}) == .75,
+        "sg14::divide test failed");
+static_assert(divide(sg14::fast_reciprocal, sg14::fixed_point<int32_t, -16>{-1}, sg14::fixed_point<int32_t, -16>{3})
+        == sg14::fixed_point<int32_t, -16>::from_data(-21845), "sg14::divide test failed");
+static_assert(sg14::divide<sg14::fixed_point<int32_t, -16>>(sg14::fast_reciprocal,
+        sg14::fixed_point<int16_t, -8>{100}, sg14::fixed_point<uint8_t, -8>{.5}) == 200, "sg14::divide test failed");
+static_assert(divide(sg14::fast_reciprocal, sg14::fixed_point<int16_t, -8>{100}, sg14::fixed_point<int16_t, -8>{.5})
+        == std::numeric_limits<sg14::fixed_point<int16_t, -8>>::max(), "sg14::divide test failed");
+static_assert(divide(sg14::fast_reciprocal, sg14::fixed_point<int16_t, -8>{-1}, sg14::fixed_point<int16_t, -8>{0})
+        == std::numeric_limits<sg14::fixed_point<int16_t, -8>>::lowest(), "sg14::divide test failed");
+
+//Compares division by reciprocal with integer division of the raw values by a type, Wide, which cannot overflow
+template<class Output, class Lhs, class Rhs, class Wide>
+void test_fast_reciprocal()
+{
+    constexpr int shift = Lhs::exponent - Rhs::exponent - Output::exponent;
+    auto max = static_cast<Wide>(std::numeric_limits<Output>::max().data());
+    auto lowest = static_cast<Wide>(std::numeric_limits<Output>::lowest().data());
+
+    std::mt19937_64 generator;
+    for (int i = 0; i != 100000; ++i) {
+        auto lhs = Lhs::from_data(static_cast<typename Lhs::rep>(generator() >> (generator() % 64)));
+        auto rhs = Rhs::from_data(static_cast<typename Rhs::rep>(generator() >> (generator() % 64)));
+        if (rhs.data() == 0) {
+            continue;
+        }
+
+        auto n = static_cast<Wide>(lhs.data()), d = static_cast<Wide>(rhs.data());
+        auto q = (shift >= 0) ? n * (Wide{1} << shift) / d : n / (d * (Wide{1} << -shift));
+        auto expected = Output::from_data(static_cast<typename Output::rep>(std::min(std::max(q, lowest), max)));
+
+        auto actual = sg14::divide<Output>(sg14::fast_reciprocal, lhs, rhs);
+        EXPECT_EQ(expected, actual)
+            << "divide fail at " << lhs << " / " << rhs << ", fixed point raw: " << actual.data();
+    }
+}
+
+TEST(math_divide, fast_reciprocal) {
+    using sg14::fixed_point;
+    test_fast_reciprocal<fixed_point<int32_t, -16>, fixed_point<int16_t, -8>, fixed_point<int16_t, -8>, int64_t>();
+    test_fast_reciprocal<fixed_point<int32_t, -20>, fixed_point<uint32_t, -32>, fixed_point<int32_t, -16>, int64_t>();
+    test_fast_reciprocal<fixed_point<int64_t, -8>, fixed_point<int32_t, 0>, fixed_point<uint8_t, -4>, int64_t>();
+    test_fast_reciprocal<fixed_point<int16_t, 4>, fixed_point<int32_t, -16>, fixed_point<int32_t, -16>, int64_t>();
+    test_fast_reciprocal<fixed_point<uint8_t, -4>, fixed_point<int8_t, -7>, fixed_point<int8_t, -7>, int64_t>();
+#if defined(SG14_INT128_ENABLED)
+    test_fast_reciprocal<fixed_point<int64_t, -32>, fixed_point<int64_t, -32>, fixed_point<int64_t, -32>, SG14_INT128>();
+    test_fast_reciprocal<fixed_point<uint64_t, -40>, fixed_point<uint64_t, -60>, fixed_point<uint64_t, -4>, SG14_INT128>();
+    test_fast_reciprocal<fixed_point<int64_t, -62>, fixed_point<int32_t, -31>, fixed_point<int64_t, 0>, SG14_INT128>();
+#endif
+}
@@ -85,3 +85,83 @@ TEST(math, FPTESTFORMAT) {
     }
 }
 
+
+TEST(math_exp, FPTESTFORMAT) {
+    using fp = sg14::fixed_point<int32_t, FPTESTEXP>;
+
+    //Sample the inputs whose results can be represented in the format
+    auto first = std::max(-fp::fractional_digits * 0.6931471805599453, static_cast<double>(std::numeric_limits<fp>::lowest()));
+    auto last = std::min(fp::integer_digits * 0.6931471805599453, static_cast<double>(std::numeric_limits<fp>::max()));
+    for (int i = 0; i <= 1000; i++) {
+        fp x{ first + (last - first) * i / 1000 };
+
+        auto expected = std::exp(static_cast<double>(x));
+        if (is_representable<fp>(expected)) {
+            EXPECT_LE(error_in_lsb(exp(x), expected), 2.)
+                << "exp fail at " << x << ", fixed point raw: " << exp(x).data();
+        }
+
+        auto expected10 = std::pow(10., static_cast<double>(x));
+        if (is_representable<fp>(expected10)) {
+            EXPECT_LE(error_in_lsb(exp10(x), expected10), 2.)
+                << "exp10 fail at " << x << ", fixed point raw: " << exp10(x).data();
+        }
+    }
+
+    if (fp::integer_digits > 0) {
+        EXPECT_EQ(exp(fp{ 0 }), fp{ 1 });
+        EXPECT_EQ(exp10(fp{ 0 }), fp{ 1 });
+    }
+}
+
+TEST(math_log, FPTESTFORMAT) {
+    using fp = sg14::fixed_point<int32_t, FPTESTEXP>;
+
+    //Powers of two have exact logarithms
+    for (int i = -fp::fractional_digits; i < fp::integer_digits; i++) {
+        auto expected = static_cast<double>(i);
+        if (is_representable<fp>(expected)) {
+            EXPECT_EQ(log2(fp{ std::exp2(i) }), fp{ i });
+        }
+    }
+
+    //Sample positive inputs logarithmically
+    for (int i = 0; i <= 1000; i++) {
+        fp x{ std::exp2(-fp::fractional_digits + fp::digits * (i / 1000.)) };
+        if (x <= fp{ 0 }) {
+            continue;
+        }
+
+        auto expected2 = std::log2(static_cast<double>(x));
+        if (is_representable<fp>(expected2)) {
+            EXPECT_LE(error_in_lsb(log2(x), expected2), 1.)
+                << "log2 fail at " << x << ", fixed point raw: " << log2(x).data();
+        }
+
+        auto expected = std::log(static_cast<double>(x));
+        if (is_representable<fp>(expected)) {
+            EXPECT_LE(error_in_lsb(log(x), expected), 1.)
+                << "log fail at " << x << ", fixed point raw: " << log(x).data();
+        }
+    }
+}
+
+TEST(math_rsqrt, FPTESTFORMAT) {
+    using fp = sg14::fixed_point<int32_t, FPTESTEXP>;
+
+    //Sample positive inputs logarithmically
+    for (int i = 0; i <= 1000; i++) {
+        fp x{ std::exp2(-fp::fractional_digits + fp::digits * (i / 1000.)) };
+        if (x <= fp{ 0 }) {
+            continue;
+        }
+
+        auto expected = 1. / std::sqrt(static_cast<double>(x));
+        if (is_representable<fp>(expected)) {
+            EXPECT_LE(error_in_lsb(rsqrt(x), expected), 1.)
+                << "rsqrt fail at " << x << ", fixed point raw: " << rsqrt(x).data();
+        }
+    }
+
+    EXPECT_EQ(rsqrt(fp{ 0 }), std::numeric_limits<fp>::max());
+}
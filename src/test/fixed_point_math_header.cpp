@@ -0,0 +1,9 @@
+//          Copyright John McFarlane 2015 - 2016.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+// sg14/bits/fixed_point_math.h compiles without first including sg14/fixed_point
+#include <sg14/bits/fixed_point_math.h>
+
+static_assert(sg14::log2(sg14::fixed_point<std::int32_t, -16>{8})==3, "sg14/bits/fixed_point_math.h test failed");
@@ -0,0 +1,402 @@
+
+//          Copyright John McFarlane 2015 - 2016.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sg14/fixed_point>
+#include <sg14/auxiliary/stochastic_rounding.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+#include <utility>
+
+using sg14::fixed_point;
+
+namespace {
+    using s15_16 = fixed_point<std::int32_t, -16>;
+    using q15 = fixed_point<std::int16_t, -15>;
+
+    using sg14::_impl::fp::rounding_shift;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// sg14::_impl::fp::rounding_shift
+
+// halves
+static_assert(rounding_shift<1>(sg14::floor_rounding, 5)==2, "sg14::floor_rounding test failed");
+static_assert(rounding_shift<1>(sg14::floor_rounding, -5)==-3, "sg14::floor_rounding test failed");
+static_assert(rounding_shift<1>(sg14::nearest_rounding, 5)==3, "sg14::nearest_rounding test failed");
+static_assert(rounding_shift<1>(sg14::nearest_rounding, -5)==-2, "sg14::nearest_rounding test failed");
+static_assert(rounding_shift<1>(sg14::nearest_even_rounding, 5)==2, "sg14::nearest_even_rounding test failed");
+static_assert(rounding_shift<1>(sg14::nearest_even_rounding, 7)==4, "sg14::nearest_even_rounding test failed");
+static_assert(rounding_shift<1>(sg14::nearest_even_rounding, -5)==-2, "sg14::nearest_even_rounding test failed");
+static_assert(rounding_shift<1>(sg14::nearest_even_rounding, -7)==-4, "sg14::nearest_even_rounding test failed");
+static_assert(rounding_shift<1>(sg14::toward_zero_rounding, 5)==2, "sg14::toward_zero_rounding test failed");
+static_assert(rounding_shift<1>(sg14::toward_zero_rounding, -5)==-2, "sg14::toward_zero_rounding test failed");
+
+// other fractions
+static_assert(rounding_shift<2>(sg14::nearest_rounding, -7)==-2, "sg14::nearest_rounding test failed");
+static_assert(rounding_shift<2>(sg14::nearest_even_rounding, 9)==2, "sg14::nearest_even_rounding test failed");
+static_assert(rounding_shift<2>(sg14::nearest_even_rounding, 11)==3, "sg14::nearest_even_rounding test failed");
+static_assert(rounding_shift<3>(sg14::toward_zero_rounding, -15)==-1, "sg14::toward_zero_rounding test failed");
+static_assert(rounding_shift<3>(sg14::toward_zero_rounding, -16)==-2, "sg14::toward_zero_rounding test failed");
+
+// no digits are lost
+static_assert(rounding_shift<0>(sg14::nearest_rounding, -7)==-7, "sg14::nearest_rounding test failed");
+static_assert(rounding_shift<-3>(sg14::toward_zero_rounding, -7)==-56, "sg14::toward_zero_rounding test failed");
+
+// extremes do not overflow
+static_assert(rounding_shift<4>(sg14::nearest_rounding, std::numeric_limits<int>::max())==0x8000000,
+        "sg14::nearest_rounding test failed");
+static_assert(rounding_shift<4>(sg14::toward_zero_rounding, std::numeric_limits<int>::min())==-0x8000000,
+        "sg14::toward_zero_rounding test failed");
+static_assert(rounding_shift<31>(sg14::toward_zero_rounding, std::numeric_limits<int>::min()+1)==0,
+        "sg14::toward_zero_rounding test failed");
+
+// every digit is lost
+static_assert(rounding_shift<32>(sg14::floor_rounding, -1)==-1, "sg14::floor_rounding test failed");
+static_assert(rounding_shift<40>(sg14::nearest_rounding, std::numeric_limits<int>::min())==0,
+        "sg14::nearest_rounding test failed");
+static_assert(rounding_shift<32>(sg14::nearest_even_rounding, std::numeric_limits<int>::max())==0,
+        "sg14::nearest_even_rounding test failed");
+
+static_assert(sg14::is_rounding_tag<sg14::nearest_even_rounding_tag>::value, "sg14::is_rounding_tag test failed");
+static_assert(!sg14::is_rounding_tag<int>::value, "sg14::is_rounding_tag test failed");
+
+////////////////////////////////////////////////////////////////////////////////
+// sg14::convert
+
+// from fixed_point
+static_assert(sg14::convert<fixed_point<std::int8_t, -1>>(sg14::floor_rounding, s15_16{-.25})==-.5,
+        "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::int8_t, -1>>(sg14::nearest_rounding, s15_16{-.25})==0,
+        "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::int8_t, -1>>(sg14::nearest_rounding, s15_16{.25})==.5,
+        "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::int8_t, -1>>(sg14::nearest_even_rounding, s15_16{.75})==1,
+        "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::int8_t, -1>>(sg14::nearest_even_rounding, s15_16{1.25})==1,
+        "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::int8_t, -1>>(sg14::toward_zero_rounding, s15_16{-1.25})==-1,
+        "sg14::convert test failed");
+static_assert(sg14::convert<q15>(sg14::nearest_rounding, fixed_point<std::int8_t, -2>{-.75})==-.75,
+        "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::int64_t, 40>>(sg14::floor_rounding, s15_16{-1}).data()==-1,
+        "sg14::convert test failed");
+
+// conversion by construction rounds toward zero
+static_assert(sg14::convert<fixed_point<std::int32_t, -8>>(sg14::toward_zero_rounding, s15_16::from_data(-1))
+        ==static_cast<fixed_point<std::int32_t, -8>>(s15_16::from_data(-1)), "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::int32_t, -8>>(sg14::floor_rounding, s15_16::from_data(-1)).data()==-1,
+        "sg14::convert test failed");
+
+// an unsigned fraction shifted out entirely is rounded up from a half
+static_assert(sg14::convert<fixed_point<std::uint8_t, 0>>(sg14::nearest_rounding, fixed_point<std::uint8_t, -8>{.75})==1,
+        "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::uint8_t, 0>>(sg14::nearest_rounding, fixed_point<std::uint8_t, -8>{.5})==1,
+        "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::uint8_t, 0>>(sg14::nearest_rounding, fixed_point<std::uint8_t, -8>{.25})==0,
+        "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::uint32_t, 0>>(sg14::nearest_even_rounding, fixed_point<std::uint32_t, -32>{.5})==0,
+        "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::uint32_t, 0>>(sg14::nearest_even_rounding,
+        fixed_point<std::uint32_t, -32>::from_data(0x80000001))==1, "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::uint8_t, 0>>(sg14::toward_zero_rounding, fixed_point<std::uint8_t, -8>{.75})==0,
+        "sg14::convert test failed");
+
+// from floating-point
+static_assert(sg14::convert<s15_16>(sg14::floor_rounding, -1e-9)==s15_16::from_data(-1),
+        "sg14::convert test failed");
+static_assert(sg14::convert<s15_16>(sg14::toward_zero_rounding, -1e-9)==s15_16{0}, "sg14::convert test failed");
+static_assert(sg14::convert<q15>(sg14::nearest_rounding, .6)==q15::from_data(19661), "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::int8_t, -1>>(sg14::nearest_rounding, -.25)==0,
+        "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::int8_t, -1>>(sg14::nearest_even_rounding, -.75)==-1,
+        "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::int8_t, -1>>(sg14::nearest_even_rounding, -.7)==-.5,
+        "sg14::convert test failed");
+
+////////////////////////////////////////////////////////////////////////////////
+// sg14::multiply with rounding
+
+static_assert(multiply(sg14::floor_rounding, q15{-.5}, q15::from_data(1))==q15::from_data(-1),
+        "sg14::multiply test failed");
+static_assert(multiply(sg14::nearest_rounding, q15{-.5}, q15::from_data(1))==q15{0}, "sg14::multiply test failed");
+static_assert(multiply(sg14::nearest_rounding, q15{.5}, q15::from_data(1))==q15::from_data(1),
+        "sg14::multiply test failed");
+static_assert(multiply(sg14::nearest_even_rounding, q15{.5}, q15::from_data(3))==q15::from_data(2),
+        "sg14::multiply test failed");
+static_assert(multiply(sg14::toward_zero_rounding, q15{-.75}, q15::from_data(3))==q15::from_data(-2),
+        "sg14::multiply test failed");
+static_assert(multiply(sg14::toward_zero_rounding, q15::from_data(-3), q15{.5})
+        ==static_cast<q15>(q15::from_data(-3)*q15{.5}), "sg14::multiply test failed");
+static_assert(multiply(sg14::floor_rounding, q15::from_data(-3), q15{.5})==q15::from_data(-2),
+        "sg14::multiply test failed");
+static_assert(std::is_same<decltype(multiply(sg14::nearest_rounding, q15{}, q15{})), q15>::value,
+        "sg14::multiply test failed");
+static_assert(sg14::multiply<s15_16>(sg14::nearest_rounding, q15{.5}, s15_16{3})==1.5, "sg14::multiply test failed");
+
+////////////////////////////////////////////////////////////////////////////////
+// sg14::fma
+
+// the product is not rounded before the addition
+static_assert(fma(s15_16::from_data(3), s15_16{.5}, s15_16{1})==s15_16::from_data(65537),
+        "sg14::fma test failed");
+static_assert(fma(s15_16::from_data(3), s15_16::from_data(0x8000), s15_16::from_data(1))==s15_16::from_data(2),
+        "sg14::fma test failed");
+static_assert(fma(sg14::nearest_rounding, s15_16::from_data(3), s15_16::from_data(0x8000), s15_16::from_data(1))
+        ==s15_16::from_data(3), "sg14::fma test failed");
+static_assert(fma(sg14::nearest_even_rounding, s15_16::from_data(1), s15_16::from_data(0x8000), s15_16::from_data(2))
+        ==s15_16::from_data(2), "sg14::fma test failed");
+static_assert(fma(sg14::toward_zero_rounding, s15_16::from_data(-3), s15_16::from_data(0x8000), s15_16{0})
+        ==s15_16::from_data(-1), "sg14::fma test failed");
+
+// by default, the result is rounded toward zero like conversion of the exact sum
+static_assert(fma(s15_16::from_data(-3), s15_16::from_data(0x8000), s15_16{0})==s15_16::from_data(-1),
+        "sg14::fma test failed");
+static_assert(fma(s15_16::from_data(-3), s15_16::from_data(0x8000), s15_16{0})
+        ==static_cast<s15_16>(s15_16::from_data(-3)*s15_16::from_data(0x8000)+s15_16{0}), "sg14::fma test failed");
+static_assert(fma(sg14::floor_rounding, s15_16::from_data(-3), s15_16::from_data(0x8000), s15_16{0})
+        ==s15_16::from_data(-2), "sg14::fma test failed");
+
+// the result takes the type of the addend unless specified
+static_assert(std::is_same<decltype(fma(q15{}, q15{}, s15_16{})), s15_16>::value, "sg14::fma test failed");
+static_assert(sg14::fma<q15>(sg14::nearest_rounding, q15{.5}, q15{-.5}, s15_16{.5})==.25, "sg14::fma test failed");
+
+// the addend may be finer than the product
+static_assert(fma(fixed_point<std::int8_t, -2>{-.25}, fixed_point<std::int8_t, 0>{3}, q15{.5})==q15{-.25},
+        "sg14::fma test failed");
+
+// the rounding argument must be a rounding tag
+namespace {
+    template<class RoundingTag, class = void>
+    struct is_fma_rounding : std::false_type {
+    };
+
+    template<class RoundingTag>
+    struct is_fma_rounding<RoundingTag, decltype(void(sg14::fma(
+            std::declval<RoundingTag>(), s15_16{}, s15_16{}, s15_16{})))> : std::true_type {
+    };
+}
+
+static_assert(is_fma_rounding<sg14::nearest_rounding_tag>::value, "sg14::fma test failed");
+static_assert(is_fma_rounding<sg14::stochastic_rounding_tag>::value, "sg14::fma test failed");
+static_assert(!is_fma_rounding<int>::value, "sg14::fma test failed");
+static_assert(!is_fma_rounding<s15_16>::value, "sg14::fma test failed");
+
+////////////////////////////////////////////////////////////////////////////////
+// reference rounding in long double, whose significand holds any sum or product of these operands exactly
+
+namespace {
+    using real = long double;
+
+    real reference_round(sg14::floor_rounding_tag, real lsbs)
+    {
+        return std::floor(lsbs);
+    }
+
+    real reference_round(sg14::nearest_rounding_tag, real lsbs)
+    {
+        return std::floor(lsbs+real{.5});
+    }
+
+    real reference_round(sg14::nearest_even_rounding_tag, real lsbs)
+    {
+        return std::nearbyint(lsbs);
+    }
+
+    real reference_round(sg14::toward_zero_rounding_tag, real lsbs)
+    {
+        return std::trunc(lsbs);
+    }
+
+    // exact rounded to a multiple of the LSB of Output; false if that is beyond the range of Output
+    template<class Output, class RoundingTag>
+    bool reference_round(RoundingTag rounding, real exact, real& expected)
+    {
+        auto lsb = static_cast<real>(std::numeric_limits<Output>::min());
+        expected = reference_round(rounding, exact/lsb)*lsb;
+        return expected>=static_cast<real>(std::numeric_limits<Output>::lowest())
+                && expected<=static_cast<real>(std::numeric_limits<Output>::max());
+    }
+
+    // a random value with a random number of leading zero or sign bits
+    template<class FixedPoint>
+    FixedPoint random_operand(std::mt19937_64& generator)
+    {
+        return FixedPoint::from_data(static_cast<typename FixedPoint::rep>(generator() >> (generator()%64)));
+    }
+
+    // calls test with each of the deterministic rounding tags
+    template<class Test>
+    void test_each_rounding(Test test)
+    {
+        test(sg14::floor_rounding);
+        test(sg14::nearest_rounding);
+        test(sg14::nearest_even_rounding);
+        test(sg14::toward_zero_rounding);
+    }
+
+    template<class Output, class A, class B, class C>
+    struct fma_test {
+        template<class RoundingTag>
+        void operator()(RoundingTag rounding) const
+        {
+            std::mt19937_64 generator;
+            for (int i = 0; i!=10000; ++i) {
+                auto a = random_operand<A>(generator);
+                auto b = random_operand<B>(generator);
+                auto c = random_operand<C>(generator);
+                real expected;
+                if (reference_round<Output>(rounding, static_cast<real>(a)*static_cast<real>(b)+static_cast<real>(c),
+                        expected)) {
+                    EXPECT_EQ(expected, static_cast<real>(sg14::fma<Output>(rounding, a, b, c)))
+                            << a << " * " << b << " + " << c;
+                }
+            }
+        }
+    };
+
+    template<class Output, class Lhs, class Rhs>
+    struct multiply_test {
+        template<class RoundingTag>
+        void operator()(RoundingTag rounding) const
+        {
+            std::mt19937_64 generator;
+            for (int i = 0; i!=10000; ++i) {
+                auto lhs = random_operand<Lhs>(generator);
+                auto rhs = random_operand<Rhs>(generator);
+                auto exact = static_cast<real>(lhs)*static_cast<real>(rhs);
+                real expected;
+                if (reference_round<Output>(rounding, exact, expected)) {
+                    EXPECT_EQ(expected, static_cast<real>(sg14::multiply<Output>(rounding, lhs, rhs)))
+                            << lhs << " * " << rhs;
+                    EXPECT_EQ(expected, static_cast<real>(sg14::convert<Output>(rounding, exact)));
+                }
+            }
+        }
+    };
+}
+
+template<class Output, class A, class B, class C>
+void test_fma()
+{
+    test_each_rounding(fma_test<Output, A, B, C>{});
+}
+
+template<class Output, class Lhs, class Rhs>
+void test_multiply()
+{
+    test_each_rounding(multiply_test<Output, Lhs, Rhs>{});
+}
+
+TEST(fixed_point_rounding, multiply)
+{
+    test_multiply<q15, q15, q15>();
+    test_multiply<s15_16, s15_16, s15_16>();
+    test_multiply<fixed_point<std::int8_t, -3>, q15, fixed_point<std::uint8_t, -4>>();
+    test_multiply<fixed_point<std::uint16_t, -4>, fixed_point<std::uint16_t, -16>, fixed_point<std::uint8_t, 0>>();
+}
+
+// stochastic rounding is unbiased: the mean of many results approaches the value
+template<class Output, class Input>
+void test_stochastic(Input input)
+{
+    using real = long double;
+    auto lsb = static_cast<real>(std::numeric_limits<Output>::min());
+    auto floor = static_cast<real>(sg14::convert<Output>(sg14::floor_rounding, input));
+
+    real sum = 0;
+    for (int i = 0; i!=100000; ++i) {
+        auto actual = static_cast<real>(sg14::convert<Output>(sg14::stochastic_rounding, input));
+        ASSERT_TRUE(actual==floor || actual==floor+lsb) << input << " rounded to " << actual;
+        sum += actual;
+    }
+    EXPECT_NEAR(static_cast<real>(input), sum/100000, lsb/64) << input;
+
+    Input inputs[1001];
+    for (auto& element : inputs) {
+        element = input;
+    }
+    Output outputs[1001];
+    sum = 0;
+    for (int i = 0; i!=100; ++i) {
+        sg14::convert(sg14::stochastic_rounding, inputs, outputs, 1001);
+        for (auto output : outputs) {
+            auto actual = static_cast<real>(output);
+            ASSERT_TRUE(actual==floor || actual==floor+lsb) << input << " rounded to " << actual;
+            sum += actual;
+        }
+    }
+    EXPECT_NEAR(static_cast<real>(input), sum/100100, lsb/64) << input;
+}
+
+TEST(fixed_point_rounding, stochastic)
+{
+    test_stochastic<fixed_point<std::int8_t, -2>>(s15_16{1.3});
+    test_stochastic<fixed_point<std::int8_t, -2>>(s15_16{-1.3});
+    test_stochastic<q15>(fixed_point<std::int64_t, -40>{-.123456789});
+    test_stochastic<fixed_point<std::uint8_t, 0>>(fixed_point<std::uint16_t, -8>{100.9});
+    test_stochastic<fixed_point<std::int16_t, 70>>(fixed_point<std::int8_t, 64>::from_data(-3));
+
+    // no digits are lost
+    EXPECT_EQ(sg14::convert<s15_16>(sg14::stochastic_rounding, q15{-.75}), s15_16{-.75});
+    q15 inputs[3] = {q15{-.75}, q15{.5}, q15{.125}};
+    s15_16 outputs[3];
+    sg14::convert(sg14::stochastic_rounding, inputs, outputs, 3);
+    EXPECT_EQ(outputs[0], s15_16{-.75});
+    EXPECT_EQ(outputs[2], s15_16{.125});
+
+    // an unsigned fraction shifted out entirely is rounded up from a half
+static_assert(sg14::convert<fixed_point<std::uint8_t, 0>>(sg14::nearest_rounding, fixed_point<std::uint8_t, -8>{.75})==1,
+        "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::uint8_t, 0>>(sg14::nearest_rounding, fixed_point<std::uint8_t, -8>{.5})==1,
+        "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::uint8_t, 0>>(sg14::nearest_rounding, fixed_point<std::uint8_t, -8>{.25})==0,
+        "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::uint32_t, 0>>(sg14::nearest_even_rounding, fixed_point<std::uint32_t, -32>{.5})==0,
+        "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::uint32_t, 0>>(sg14::nearest_even_rounding,
+        fixed_point<std::uint32_t, -32>::from_data(0x80000001))==1, "sg14::convert test failed");
+static_assert(sg14::convert<fixed_point<std::uint8_t, 0>>(sg14::toward_zero_rounding, fixed_point<std::uint8_t, -8>{.75})==0,
+        "sg14::convert test failed");
+
+// from floating-point
+    auto sum = 0.;
+    for (int i = 0; i!=100000; ++i) {
+        sum += static_cast<double>(sg14::convert<fixed_point<std::int8_t, -2>>(sg14::stochastic_rounding, -.3));
+    }
+    EXPECT_NEAR(-.3, sum/100000, .01);
+
+    // products
+    sum = 0;
+    for (int i = 0; i!=100000; ++i) {
+        sum += static_cast<double>(multiply(sg14::stochastic_rounding, q15::from_data(3), q15{.5}));
+    }
+    EXPECT_NEAR(1.5, sum/100000*32768, .01);
+
+    // seeding reproduces the sequence
+    sg14::seed_stochastic_rounding(123);
+    q15 first[100];
+    for (auto& element : first) {
+        element = sg14::convert<q15>(sg14::stochastic_rounding, s15_16::from_data(1));
+    }
+    sg14::seed_stochastic_rounding(123);
+    for (auto& element : first) {
+        EXPECT_EQ(element, sg14::convert<q15>(sg14::stochastic_rounding, s15_16::from_data(1)));
+    }
+}
+
+TEST(fixed_point_rounding, fma)
+{
+    test_fma<s15_16, s15_16, s15_16, s15_16>();
+    test_fma<q15, q15, q15, q15>();
+    test_fma<s15_16, q15, q15, s15_16>();
+    test_fma<fixed_point<std::uint8_t, -4>, fixed_point<std::uint8_t, -8>, fixed_point<std::int8_t, 2>, q15>();
+#if defined(SG14_INT128_ENABLED)
+    test_fma<fixed_point<std::int32_t, -24>, fixed_point<std::uint16_t, -8>, q15, fixed_point<std::int64_t, -40>>();
+#endif
+}
@@ -13,6 +13,10 @@
 
 #include <sg14/auxiliary/overflow.h>
 
+#include <gtest/gtest.h>
+
+#include <random>
+
 // TODO: remove ASAP
 #if defined(_MSC_VER)
 #pragma warning(disable: 4307)
@@ -268,3 +272,153 @@ namespace {
                 std::numeric_limits<short>::max()), "sg14::convert test failed");
     }
 }
+
+// at run time, overflow is detected by the compiler's builtins where available;
+// these must agree with the portable tests used in constant expressions
+template<class Operator, class Lhs, class Rhs>
+void test_is_overflow()
+{
+    std::mt19937_64 generator;
+    for (int index = 0; index!=10000; ++index) {
+        auto lhs = static_cast<Lhs>(generator() >> (generator()%64));
+        auto rhs = static_cast<Rhs>(generator() >> (generator()%64));
+        EXPECT_EQ(sg14::_overflow_impl::portable_overflow<Operator>::is_overflow(lhs, rhs),
+                sg14::_overflow_impl::is_overflow<Operator>(lhs, rhs)) << "is_overflow fail at " << lhs << ", " << rhs;
+        EXPECT_EQ(sg14::_overflow_impl::portable_overflow<Operator>::saturate(lhs, rhs),
+                sg14::_overflow_impl::saturate<Operator>(lhs, rhs)) << "saturate fail at " << lhs << ", " << rhs;
+    }
+}
+
+template<class Operator, class Lhs, class Rhs>
+void expect_is_overflow(Lhs lhs, Rhs rhs)
+{
+    EXPECT_EQ(sg14::_overflow_impl::portable_overflow<Operator>::is_overflow(lhs, rhs),
+            sg14::_overflow_impl::is_overflow<Operator>(lhs, rhs)) << "is_overflow fail at " << lhs << ", " << rhs;
+    EXPECT_EQ(sg14::_overflow_impl::portable_overflow<Operator>::saturate(lhs, rhs),
+            sg14::_overflow_impl::saturate<Operator>(lhs, rhs)) << "saturate fail at " << lhs << ", " << rhs;
+}
+
+template<class Lhs, class Rhs>
+void test_is_overflow()
+{
+    test_is_overflow<sg14::_impl::add_op, Lhs, Rhs>();
+    test_is_overflow<sg14::_impl::subtract_op, Lhs, Rhs>();
+    test_is_overflow<sg14::_impl::multiply_op, Lhs, Rhs>();
+}
+
+TEST(overflow, is_overflow)
+{
+    test_is_overflow<std::int32_t, std::int32_t>();
+    test_is_overflow<std::int64_t, std::int64_t>();
+    test_is_overflow<std::uint32_t, std::uint32_t>();
+    test_is_overflow<std::uint64_t, std::uint64_t>();
+    test_is_overflow<std::int8_t, std::int8_t>();
+    test_is_overflow<std::uint16_t, std::int32_t>();
+    test_is_overflow<std::int32_t, std::uint32_t>();
+    test_is_overflow<std::int64_t, std::uint32_t>();
+
+    // operands of -1 and the limits, e.g. lowest()/-1, which traps
+    for (auto lhs : {std::numeric_limits<std::int32_t>::lowest(), -1, 1, std::numeric_limits<std::int32_t>::max()}) {
+        for (auto rhs : {std::numeric_limits<std::int32_t>::lowest(), -1, 1, std::numeric_limits<std::int32_t>::max()}) {
+            expect_is_overflow<sg14::_impl::multiply_op>(lhs, rhs);
+        }
+    }
+    expect_is_overflow<sg14::_impl::multiply_op>(std::numeric_limits<std::int64_t>::lowest(), std::int64_t{-1});
+    expect_is_overflow<sg14::_impl::multiply_op>(std::int64_t{7}, std::int64_t{-1});
+    EXPECT_TRUE(sg14::_overflow_impl::portable_overflow<sg14::_impl::multiply_op>::is_overflow(
+            std::numeric_limits<std::int64_t>::lowest(), std::int64_t{-1}));
+    EXPECT_FALSE(sg14::_overflow_impl::portable_overflow<sg14::_impl::multiply_op>::is_overflow(
+            std::numeric_limits<std::int64_t>::max(), std::int64_t{-1}));
+}
+
+template<class Destination, class Source>
+void test_convert_saturated()
+{
+    std::mt19937_64 generator;
+    for (int index = 0; index!=10000; ++index) {
+        auto source = static_cast<Source>(generator() >> (generator()%64));
+        EXPECT_EQ(sg14::_overflow_impl::portable_convert_saturated<Destination>(source),
+                convert<Destination>(sg14::saturated_overflow, source)) << "convert fail at " << source;
+    }
+}
+
+TEST(overflow, convert_saturated)
+{
+    test_convert_saturated<std::int8_t, std::int32_t>();
+    test_convert_saturated<std::uint8_t, std::int32_t>();
+    test_convert_saturated<std::int16_t, std::int64_t>();
+    test_convert_saturated<std::int32_t, std::uint32_t>();
+    test_convert_saturated<std::uint32_t, std::int64_t>();
+    test_convert_saturated<std::int64_t, std::uint64_t>();
+    test_convert_saturated<std::uint64_t, std::int8_t>();
+}
+
+TEST(overflow, saturated)
+{
+    // values read from volatile objects are not known at compile time
+    volatile std::int32_t volatile_int32_max = std::numeric_limits<std::int32_t>::max();
+    volatile std::int64_t volatile_int64_min = std::numeric_limits<std::int64_t>::min();
+    volatile unsigned volatile_zero = 0U;
+    volatile std::int8_t volatile_int8_min = std::numeric_limits<std::int8_t>::min();
+    std::int32_t int32_max = volatile_int32_max;
+    std::int32_t int32_min = -int32_max-1;
+    std::int64_t int64_min = volatile_int64_min;
+    unsigned zero = volatile_zero;
+    std::int8_t int8_min = volatile_int8_min;
+
+    EXPECT_EQ(int32_max, add(sg14::saturated_overflow, int32_max, 1));
+    EXPECT_EQ(int32_min, add(sg14::saturated_overflow, int32_min, -1));
+    EXPECT_EQ(int32_max, subtract(sg14::saturated_overflow, 0, int32_min));
+    EXPECT_EQ(int32_min, subtract(sg14::saturated_overflow, -2, int32_max));
+    EXPECT_EQ(int32_max, multiply(sg14::saturated_overflow, int32_max, 2));
+    EXPECT_EQ(int32_min, multiply(sg14::saturated_overflow, int32_max, -2));
+    EXPECT_EQ(std::numeric_limits<std::int64_t>::max(), multiply(sg14::saturated_overflow, int64_min, INT64_C(-1)));
+    EXPECT_EQ(0U, subtract(sg14::saturated_overflow, zero, 2U));
+    EXPECT_EQ(1U, subtract(sg14::saturated_overflow, zero, -1));
+    EXPECT_EQ(-256, multiply(sg14::saturated_overflow, int8_min, 2));
+}
+
+#if defined(SG14_EXCEPTIONS_ENABLED)
+TEST(overflow, throwing)
+{
+    volatile std::int64_t volatile_int64_max = std::numeric_limits<std::int64_t>::max();
+    std::int64_t int64_max = volatile_int64_max;
+
+    EXPECT_THROW(add(sg14::throwing_overflow, int64_max, INT64_C(1)), std::overflow_error);
+    EXPECT_THROW(subtract(sg14::throwing_overflow, -int64_max, INT64_C(2)), std::overflow_error);
+    EXPECT_THROW(multiply(sg14::throwing_overflow, int64_max, INT64_C(2)), std::overflow_error);
+    EXPECT_EQ(int64_max, add(sg14::throwing_overflow, int64_max-1, INT64_C(1)));
+}
+#endif
+
+TEST(overflow, sticky)
+{
+    volatile std::int32_t volatile_int32_max = std::numeric_limits<std::int32_t>::max();
+    std::int32_t int32_max = volatile_int32_max;
+
+    sg14::clear_sticky_overflow();
+
+    // results match native_overflow_tag and the flag is untouched while nothing overflows
+    EXPECT_EQ(int32_max, add(sg14::sticky_overflow, int32_max-1, 1));
+    EXPECT_EQ(-int32_max, subtract(sg14::sticky_overflow, 0, int32_max));
+    EXPECT_EQ(int32_max-1, multiply(sg14::sticky_overflow, int32_max/2, 2));
+    EXPECT_EQ(127, convert<std::int8_t>(sg14::sticky_overflow, int32_max-(int32_max-127)));
+    EXPECT_EQ(-2, convert<std::int16_t>(sg14::sticky_overflow, -2.5));
+    EXPECT_FALSE(sg14::sticky_overflow_occurred());
+
+    // once set, the flag stays set until cleared
+    EXPECT_EQ(UINT32_MAX, subtract(sg14::sticky_overflow, static_cast<std::uint32_t>(int32_max-int32_max), UINT32_C(1)));
+    EXPECT_TRUE(sg14::sticky_overflow_occurred());
+    EXPECT_EQ(3, add(sg14::sticky_overflow, 1, 2));
+    EXPECT_TRUE(sg14::sticky_overflow_occurred());
+    EXPECT_TRUE(sg14::clear_sticky_overflow());
+    EXPECT_FALSE(sg14::sticky_overflow_occurred());
+    EXPECT_FALSE(sg14::clear_sticky_overflow());
+
+    EXPECT_EQ(-2, multiply(sg14::sticky_overflow, int32_max, 2));
+    EXPECT_TRUE(sg14::clear_sticky_overflow());
+    EXPECT_EQ(-1, convert<std::int16_t>(sg14::sticky_overflow, int32_max));
+    EXPECT_TRUE(sg14::clear_sticky_overflow());
+    EXPECT_EQ(255, convert<std::uint8_t>(sg14::sticky_overflow, int32_max-int32_max-1));
+    EXPECT_TRUE(sg14::clear_sticky_overflow());
+}
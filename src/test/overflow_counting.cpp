@@ -0,0 +1,83 @@
+
+//          Copyright John McFarlane 2015 - 2016.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sg14/auxiliary/overflow_counting.h>
+#include <sg14/auxiliary/safe_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+using sg14::safe_integer;
+
+namespace {
+    struct mixer_gain {
+        static char const* name() { return "mixer_gain"; }
+    };
+
+    struct mixer_sum {
+        static char const* name() { return "mixer_sum"; }
+    };
+
+    struct conversion_site {
+        static char const* name() { return "conversion_site"; }
+    };
+
+    template<class Key>
+    using counted_integer = safe_integer<std::int16_t, sg14::counting_overflow_tag<Key>>;
+
+    std::uint64_t count_of(char const* name)
+    {
+        auto counts = sg14::overflow_counts();
+        auto found = std::find_if(counts.begin(), counts.end(), [name](sg14::overflow_count const& count) {
+            return std::strcmp(count.name, name)==0;
+        });
+        return (found==counts.end()) ? 0 : found->count;
+    }
+}
+
+TEST(overflow_counting, safe_integer)
+{
+    auto before_gain = count_of("mixer_gain");
+    auto before_sum = count_of("mixer_sum");
+
+    // results saturate as well as being counted against the key of each expression
+    auto gain = counted_integer<mixer_gain>{std::int16_t{4}};
+    auto sample = counted_integer<mixer_gain>{std::int16_t{10000}};
+    auto product = sample*gain;
+    EXPECT_EQ(40000, product);
+
+    auto narrowed = counted_integer<mixer_gain>{product};
+    EXPECT_EQ(std::numeric_limits<std::int16_t>::max(), narrowed);
+
+    using counted_int32 = safe_integer<std::int32_t, sg14::counting_overflow_tag<mixer_sum>>;
+    auto sum = counted_int32{std::numeric_limits<std::int32_t>::max()}+counted_int32{1};
+    EXPECT_EQ(std::numeric_limits<std::int32_t>::max(), sum);
+    EXPECT_EQ(3, counted_int32{1}+counted_int32{2});
+    EXPECT_TRUE(counted_int32{1}<counted_int32{2});
+
+    EXPECT_EQ(before_gain+1, count_of("mixer_gain"));
+    EXPECT_EQ(before_sum+1, count_of("mixer_sum"));
+}
+
+TEST(overflow_counting, threads)
+{
+    auto before = count_of("conversion_site");
+    auto convert_block = [] {
+        for (auto value = 0; value!=1000; ++value) {
+            sg14::convert<std::int8_t>(sg14::counting_overflow_tag<conversion_site, sg14::native_overflow_tag>{}, value);
+        }
+    };
+
+    // counts of threads which have finished are retained
+    std::thread first(convert_block), second(convert_block);
+    first.join();
+    second.join();
+    convert_block();
+    EXPECT_EQ(before+3*(1000-128), count_of("conversion_site"));
+}
@@ -27,4 +27,74 @@ namespace {
                 precise_integer<>(-8)), "precise_fixed_point ctor test failed");
         static_assert(precise_fixed_point<>(0) == from_rep<precise_fixed_point<>>(0), "precise_fixed_point ctor test failed");
     }
+
+    namespace test_rounding_policy_divide {
+        using sg14::closest_rounding_policy;
+        using sg14::nearest_even_rounding_policy;
+        using sg14::floor_rounding_policy;
+        using sg14::ceiling_rounding_policy;
+
+        static_assert(closest_rounding_policy::divide(5, 2)==3, "sg14::closest_rounding_policy test failed");
+        static_assert(closest_rounding_policy::divide(-5, 2)==-3, "sg14::closest_rounding_policy test failed");
+        static_assert(closest_rounding_policy::divide(-9, 4)==-2, "sg14::closest_rounding_policy test failed");
+        static_assert(closest_rounding_policy::divide(std::numeric_limits<int>::max(), 0x40000000)==2,
+                "sg14::closest_rounding_policy test failed");
+
+        static_assert(nearest_even_rounding_policy::divide(5, 2)==2, "sg14::nearest_even_rounding_policy test failed");
+        static_assert(nearest_even_rounding_policy::divide(7, 2)==4, "sg14::nearest_even_rounding_policy test failed");
+        static_assert(nearest_even_rounding_policy::divide(-5, 2)==-2, "sg14::nearest_even_rounding_policy test failed");
+        static_assert(nearest_even_rounding_policy::divide(-7, 2)==-4, "sg14::nearest_even_rounding_policy test failed");
+        static_assert(nearest_even_rounding_policy::divide(-11, 4)==-3, "sg14::nearest_even_rounding_policy test failed");
+
+        static_assert(floor_rounding_policy::divide(-5, 2)==-3, "sg14::floor_rounding_policy test failed");
+        static_assert(floor_rounding_policy::divide(5, 2)==2, "sg14::floor_rounding_policy test failed");
+        static_assert(floor_rounding_policy::divide(-4, 2)==-2, "sg14::floor_rounding_policy test failed");
+
+        static_assert(ceiling_rounding_policy::divide(-5, 2)==-2, "sg14::ceiling_rounding_policy test failed");
+        static_assert(ceiling_rounding_policy::divide(5, 2)==3, "sg14::ceiling_rounding_policy test failed");
+        static_assert(ceiling_rounding_policy::divide(4, 2)==2, "sg14::ceiling_rounding_policy test failed");
+    }
+
+    namespace test_rounding_policy_convert {
+        static_assert(precise_integer<int, sg14::nearest_even_rounding_policy>{2.5}==2,
+                "sg14::nearest_even_rounding_policy test failed");
+        static_assert(precise_integer<int, sg14::nearest_even_rounding_policy>{-3.5}==-4,
+                "sg14::nearest_even_rounding_policy test failed");
+        static_assert(precise_integer<int, sg14::floor_rounding_policy>{-2.5}==-3,
+                "sg14::floor_rounding_policy test failed");
+        static_assert(precise_integer<int, sg14::ceiling_rounding_policy>{-2.5}==-2,
+                "sg14::ceiling_rounding_policy test failed");
+        static_assert(precise_integer<int, sg14::ceiling_rounding_policy>{2.25}==3,
+                "sg14::ceiling_rounding_policy test failed");
+    }
+
+    // conversions which lose digits round as specified by the policy of the rep
+    namespace test_narrowing {
+        template<class RoundingPolicy>
+        constexpr double narrow(double input)
+        {
+            return static_cast<double>(precise_fixed_point<int, -1, RoundingPolicy>{
+                    precise_fixed_point<int, -2, RoundingPolicy>{input}});
+        }
+
+        static_assert(narrow<sg14::closest_rounding_policy>(1.25)==1.5, "precise_fixed_point narrowing test failed");
+        static_assert(narrow<sg14::closest_rounding_policy>(-1.25)==-1.5, "precise_fixed_point narrowing test failed");
+        static_assert(narrow<sg14::nearest_even_rounding_policy>(1.25)==1, "precise_fixed_point narrowing test failed");
+        static_assert(narrow<sg14::nearest_even_rounding_policy>(-1.25)==-1, "precise_fixed_point narrowing test failed");
+        static_assert(narrow<sg14::nearest_even_rounding_policy>(1.75)==2, "precise_fixed_point narrowing test failed");
+        static_assert(narrow<sg14::floor_rounding_policy>(1.25)==1, "precise_fixed_point narrowing test failed");
+        static_assert(narrow<sg14::floor_rounding_policy>(-1.25)==-1.5, "precise_fixed_point narrowing test failed");
+        static_assert(narrow<sg14::ceiling_rounding_policy>(1.25)==1.5, "precise_fixed_point narrowing test failed");
+        static_assert(narrow<sg14::ceiling_rounding_policy>(-1.25)==-1, "precise_fixed_point narrowing test failed");
+
+#if defined(SG14_INT128_ENABLED)
+        // reps wider than std::intmax_t
+        using wide = precise_fixed_point<SG14_INT128, -96, sg14::nearest_even_rounding_policy>;
+        using narrower = precise_fixed_point<SG14_INT128, -1, sg14::nearest_even_rounding_policy>;
+        static_assert(narrower{wide{-2.75}}==-3, "precise_fixed_point narrowing test failed");
+        static_assert(narrower{wide{-2.25}}==-2, "precise_fixed_point narrowing test failed");
+        static_assert(narrower{wide{1073741824.25}}==1073741824,
+                "precise_fixed_point narrowing test failed");
+#endif
+    }
 }
@@ -5,6 +5,7 @@
 //          http://www.boost.org/LICENSE_1_0.txt)
 
 #include <sg14/auxiliary/precise_integer.h>
+#include <sg14/auxiliary/stochastic_rounding.h>
 
 #include "number_test.h"
 
@@ -152,3 +153,37 @@ struct precise_integer_tests {
 };
 
 template struct number_test_by_rep_by_policy<precise_integer, sg14::closest_rounding_policy, precise_integer_tests>;
+
+TEST(precise_integer, stochastic_rounding_policy)
+{
+    using precise_integer = sg14::precise_integer<int, sg14::stochastic_rounding_policy>;
+
+    EXPECT_EQ(precise_integer{3.}, 3);
+    EXPECT_EQ(precise_integer{-3.}, -3);
+
+    // rounded either way, but 2.25 on average
+    auto sum = 0;
+    for (auto i = 0; i!=100000; ++i) {
+        auto rounded = precise_integer{2.25};
+        ASSERT_TRUE(rounded==2 || rounded==3);
+        sum += static_cast<int>(rounded);
+    }
+    EXPECT_NEAR(2.25, sum/100000., .01);
+
+    sum = 0;
+    for (auto i = 0; i!=100000; ++i) {
+        auto rounded = precise_integer{-.75};
+        ASSERT_TRUE(rounded==-1 || rounded==0);
+        sum += static_cast<int>(rounded);
+    }
+    EXPECT_NEAR(-.75, sum/100000., .01);
+
+    // scaling down, e.g. by conversion to fixed_point with fewer fractional digits
+    sum = 0;
+    for (auto i = 0; i!=100000; ++i) {
+        auto scaled = sg14::scale<precise_integer>()(precise_integer{-5}, 2, -2);
+        ASSERT_TRUE(scaled==-2 || scaled==-1);
+        sum += scaled;
+    }
+    EXPECT_NEAR(-1.25, sum/100000., .01);
+}
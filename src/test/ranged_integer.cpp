@@ -0,0 +1,142 @@
+
+//          Copyright John McFarlane 2015 - 2017.
+// Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file ../../LICENSE_1_0.txt or copy at
+//          http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sg14/auxiliary/ranged_integer.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+using sg14::fixed_point;
+using sg14::ranged_integer;
+using std::is_same;
+
+namespace {
+    struct gain {
+        static char const* name() { return "gain"; }
+    };
+
+    struct accumulator {
+        static char const* name() { return "accumulator"; }
+    };
+
+    struct sample {
+        static char const* name() { return "sample"; }
+    };
+
+    struct worker {
+        static char const* name() { return "worker"; }
+    };
+
+    namespace traits {
+        using sg14::_impl::is_derived_from_number_base;
+
+        static_assert(is_derived_from_number_base<ranged_integer<>>::value, "");
+        static_assert(sg14::digits<ranged_integer<std::int16_t, gain>>::value==15, "");
+        static_assert(is_same<sg14::set_digits_t<ranged_integer<std::int16_t, gain>, 31>, ranged_integer<std::int32_t, gain>>::value, "");
+        static_assert(is_same<sg14::make_unsigned_t<ranged_integer<std::int16_t, gain>>, ranged_integer<std::uint16_t, gain>>::value, "");
+
+        // results of arithmetic and operands converted from other types are not values of any variable
+        static_assert(is_same<decltype(ranged_integer<std::int16_t, gain>{}*ranged_integer<std::int16_t, gain>{}), ranged_integer<int>>::value, "");
+        static_assert(is_same<sg14::from_value_t<ranged_integer<std::int64_t, gain>, int>, ranged_integer<int>>::value, "");
+        static_assert(is_same<decltype(ranged_integer<std::int64_t, gain>{} < ranged_integer<std::int64_t, gain>{}), bool>::value, "");
+    }
+}
+
+TEST(ranged_integer, profile)
+{
+    using gain_integer = ranged_integer<std::int32_t, gain>;
+    auto a = gain_integer{-5};
+    auto b = gain_integer{96};
+    gain_integer c = a*b;
+    c = c+1;
+
+    // copies and intermediate results are not recorded
+    auto d = c;
+    EXPECT_EQ(-479, d);
+
+    auto profile = sg14::range_profile_of<gain>();
+    EXPECT_STREQ("gain", profile.name);
+    EXPECT_EQ(4u, profile.count);
+    EXPECT_EQ(-480, profile.min);
+    EXPECT_EQ(96, profile.max);
+
+    // -480 and -479 need 9 digits; 96 needs 7; -5 needs 3
+    EXPECT_EQ(2u, profile.histogram[9]);
+    EXPECT_EQ(1u, profile.histogram[7]);
+    EXPECT_EQ(1u, profile.histogram[3]);
+    EXPECT_EQ(9, profile.integer_digits());
+    EXPECT_EQ(0, profile.fractional_digits());
+}
+
+TEST(ranged_integer, fixed_point)
+{
+    // run a leaky integrator on captured data with more digits than it could ever need
+    using sample_type = fixed_point<ranged_integer<std::int64_t, sample>, -32>;
+    using accumulator_type = fixed_point<ranged_integer<std::int64_t, accumulator>, -32>;
+
+    auto const captured = {.5, -.75, .25, .125, -1., .375};
+    auto total = accumulator_type{0};
+    for (auto value : captured) {
+        auto s = sample_type{value};
+        total = total*.5+s;
+    }
+    EXPECT_EQ(-.09375, static_cast<double>(total));
+
+    // samples lie in [-1, .5] and are multiples of 2^-3; negative one needs no integer digits besides the sign
+    auto samples = sg14::range_profile_of<sample>();
+    EXPECT_EQ(6u, samples.count);
+    EXPECT_EQ(0, samples.integer_digits(sample_type::exponent));
+    EXPECT_EQ(3, samples.fractional_digits(sample_type::exponent));
+
+    // the accumulator lies in [-.9375, .5] and its last value, -.09375, is a multiple of 2^-5
+    auto accumulated = sg14::range_profile_of<accumulator>();
+    EXPECT_EQ(7u, accumulated.count);
+    EXPECT_EQ(-.9375, std::ldexp(static_cast<double>(accumulated.min), accumulator_type::exponent));
+    EXPECT_EQ(.5, std::ldexp(static_cast<double>(accumulated.max), accumulator_type::exponent));
+    EXPECT_EQ(0, accumulated.integer_digits(accumulator_type::exponent));
+    EXPECT_EQ(5, accumulated.fractional_digits(accumulator_type::exponent));
+
+    // digits are reported for the exponent of the fixed_point type
+    auto stream = std::tmpfile();
+    ASSERT_NE(nullptr, stream);
+    sg14::dump_range_profiles(stream, accumulator_type::exponent);
+    std::rewind(stream);
+    char line[256];
+    auto found = false;
+    while (std::fgets(line, sizeof line, stream)) {
+        found |= std::strncmp(line, "accumulator: 7 [", 16)==0 && std::strstr(line, "] 0.5\n");
+    }
+    std::fclose(stream);
+    EXPECT_TRUE(found);
+
+    auto profiles = sg14::range_profiles();
+    EXPECT_NE(profiles.end(), std::find_if(profiles.begin(), profiles.end(), [](sg14::range_profile const& profile) {
+        return std::strcmp(profile.name, "accumulator")==0;
+    }));
+}
+
+TEST(ranged_integer, threads)
+{
+    // records of each thread are combined, including those of threads which have finished
+    std::thread first([] { ranged_integer<std::int16_t, worker>{-300}; });
+    first.join();
+    std::thread second([] { ranged_integer<std::int16_t, worker>{700}; });
+    second.join();
+
+    auto profile = sg14::range_profile_of<worker>();
+    EXPECT_EQ(2u, profile.count);
+    EXPECT_EQ(-300, profile.min);
+    EXPECT_EQ(700, profile.max);
+    EXPECT_EQ(10, profile.integer_digits());
+
+    // both values are multiples of four so the two lowest digits are never used
+    EXPECT_EQ(-2, profile.fractional_digits());
+}
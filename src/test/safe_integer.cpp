@@ -18,6 +18,8 @@
 
 #include "number_test.h"
 
+#include <gtest/gtest.h>
+
 using sg14::_impl::identical;
 using sg14::_impl::is_integer_or_float;
 using sg14::_integer_impl::is_safe_integer;
@@ -38,6 +40,9 @@ using throwing_integer = safe_integer<Rep, sg14::throwing_overflow_tag>;
 template<typename Rep = int>
 using saturated_integer = safe_integer<Rep, sg14::saturated_overflow_tag>;
 
+template<typename Rep = int>
+using sticky_integer = safe_integer<Rep, sg14::sticky_overflow_tag>;
+
 ////////////////////////////////////////////////////////////////////////////////
 // sg14::safe_integer template parameters default
 
@@ -441,3 +446,31 @@ template struct number_test_by_rep_by_policy<safe_integer, sg14::saturated_overf
 #if defined(SG14_EXCEPTIONS_ENABLED)
 template struct number_test_by_rep_by_policy<safe_integer, sg14::throwing_overflow_tag, test_safe_integer>;
 #endif
+
+////////////////////////////////////////////////////////////////////////////////
+// sticky_overflow_tag
+
+TEST(safe_integer, sticky)
+{
+    sg14::clear_sticky_overflow();
+
+    // a block of samples is processed and then checked once for overflow
+    std::int16_t samples[] = {1000, -2000, 30000, 400};
+    auto gain = sticky_integer<std::int16_t>{2};
+    auto sum = sticky_integer<std::int32_t>{0};
+    for (auto sample : samples) {
+        sum = sum+sticky_integer<std::int16_t>{sample}*gain;
+    }
+    EXPECT_EQ(58800, sum);
+    EXPECT_FALSE(sg14::clear_sticky_overflow());
+
+    auto narrowed = sticky_integer<std::int16_t>{sum};
+    EXPECT_EQ(static_cast<std::int16_t>(58800), narrowed);
+    EXPECT_TRUE(sg14::clear_sticky_overflow());
+
+    auto big = sticky_integer<std::int64_t>{INT64_MAX};
+    EXPECT_EQ(INT64_MIN, big+1);
+    EXPECT_TRUE(sg14::sticky_overflow_occurred());
+    EXPECT_TRUE(big>0);
+    EXPECT_TRUE(sg14::clear_sticky_overflow());
+}
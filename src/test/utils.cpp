@@ -16,23 +16,124 @@ using sg14::make_ufixed;
 TEST(utils_tests, sin)
 {
     ASSERT_EQ(sin(fixed_point<std::uint8_t, -6>(0)), 0);
-    ASSERT_EQ(sin(fixed_point<std::int16_t, -13>(3.1415926)), 0.f);
+    ASSERT_EQ(sin(fixed_point<std::int16_t, -13>(3.1415926)), (fixed_point<std::int16_t, -13>::from_data(1)));
     ASSERT_EQ(sin(fixed_point<std::uint16_t, -14>(3.1415926/2)), 1);
     ASSERT_EQ(sin(fixed_point<std::int32_t, -24>(3.1415926*7./2.)), -1);
     ASSERT_EQ(sin(fixed_point<std::int32_t, -28>(3.1415926/4)), .707106769f);
-    ASSERT_EQ(sin(fixed_point<std::int16_t, -10>(-3.1415926/3)), -.865234375);
+    ASSERT_EQ(sin(fixed_point<std::int16_t, -10>(-3.1415926/3)), -.8662109375);
 }
 
 TEST(utils_tests, cos)
 {
     ASSERT_EQ(cos(fixed_point<std::uint8_t, -6>(0)), 1.f);
     ASSERT_EQ(cos(fixed_point<std::int16_t, -13>(3.1415926)), -1);
-    ASSERT_EQ(cos(fixed_point<std::uint16_t, -14>(3.1415926/2)), 0.L);
+    ASSERT_EQ(cos(fixed_point<std::uint16_t, -14>(3.1415926/2)), (fixed_point<std::uint16_t, -14>::from_data(1)));
     ASSERT_EQ(cos(fixed_point<std::int32_t, -20>(3.1415926*7./2.)), 0.f);
-    ASSERT_EQ(cos(fixed_point<std::int32_t, -28>(3.1415926/4)), .707106829f);
+    ASSERT_EQ(cos(fixed_point<std::int32_t, -28>(3.1415926/4)), .7071067914366722);
     ASSERT_EQ(cos(fixed_point<std::int16_t, -10>(-3.1415926/3)), .5L);
 }
 
+TEST(utils_tests, atan)
+{
+    ASSERT_EQ(atan(fixed_point<std::uint8_t, -6>(0)), 0);
+    ASSERT_EQ(atan(fixed_point<std::int16_t, -13>(1)), .785400390625);
+    ASSERT_EQ(atan(fixed_point<std::int16_t, -13>(-1)), -.785400390625);
+    ASSERT_EQ(atan(fixed_point<std::int32_t, -16>(1000)), 1.569793701171875);
+    ASSERT_EQ(atan(fixed_point<std::int32_t, -28>(.5)), 0.46364760771393776);
+}
+
+template<class Rep, int Exponent, class Function, class Reference>
+void test_trig_lsb(Function f, Reference reference, double first, double last)
+{
+    using fp = fixed_point<Rep, Exponent>;
+    auto step = std::max(fp{(last-first)/997}, std::numeric_limits<fp>::min());
+    for (auto input = fp{first}; input<=fp{last}-step; input += step) {
+        auto expected = fp{reference(static_cast<double>(input))};
+        auto actual = f(input);
+        EXPECT_LE(std::abs(static_cast<double>(actual.data())-static_cast<double>(expected.data())), 1.)
+                << "input: " << input << ", actual: " << actual << ", expected: " << expected;
+    }
+}
+
+struct sin_function {
+    template<class T>
+    T operator()(const T& x) const { return sin(x); }
+};
+
+struct cos_function {
+    template<class T>
+    T operator()(const T& x) const { return cos(x); }
+};
+
+struct atan_function {
+    template<class T>
+    T operator()(const T& x) const { return atan(x); }
+};
+
+TEST(utils_tests, sin_accuracy)
+{
+    auto f = sin_function{};
+    auto reference = [](double x) { return std::sin(x); };
+    test_trig_lsb<std::int8_t, -5>(f, reference, -3.9, 3.9);
+    test_trig_lsb<std::int16_t, -12>(f, reference, -7.9, 7.9);
+    test_trig_lsb<std::int32_t, -16>(f, reference, -100., 100.);
+    test_trig_lsb<std::int32_t, -29>(f, reference, -3.9, 3.9);
+    test_trig_lsb<std::int64_t, -40>(f, reference, -1000., 1000.);
+    test_trig_lsb<std::int64_t, -48>(f, reference, -30., 30.);
+}
+
+TEST(utils_tests, cos_accuracy)
+{
+    auto f = cos_function{};
+    auto reference = [](double x) { return std::cos(x); };
+    test_trig_lsb<std::int8_t, -5>(f, reference, -3.9, 3.9);
+    test_trig_lsb<std::uint16_t, -14>(f, reference, 0., 1.5);
+    test_trig_lsb<std::int32_t, -16>(f, reference, -100., 100.);
+    test_trig_lsb<std::int64_t, -40>(f, reference, -1000., 1000.);
+    test_trig_lsb<std::int64_t, -48>(f, reference, -30., 30.);
+}
+
+TEST(utils_tests, atan_accuracy)
+{
+    auto f = atan_function{};
+    auto reference = [](double x) { return std::atan(x); };
+    test_trig_lsb<std::int8_t, -5>(f, reference, -3.9, 3.9);
+    test_trig_lsb<std::int16_t, -8>(f, reference, -100., 100.);
+    test_trig_lsb<std::int32_t, -16>(f, reference, -10000., 10000.);
+    test_trig_lsb<std::int64_t, -40>(f, reference, -1000., 1000.);
+    test_trig_lsb<std::int64_t, -48>(f, reference, -10000., 10000.);
+}
+
+// native fixed-point trigonometric functions are constexpr
+static_assert(sin(fixed_point<std::int32_t, -16>(0))==0, "sg14::sin test failed");
+static_assert(cos(fixed_point<std::int32_t, -16>(0))==1, "sg14::cos test failed");
+static_assert(sin(fixed_point<std::int16_t, -14>(-3.1415926/2))==-1, "sg14::sin test failed");
+static_assert(atan(fixed_point<std::int32_t, -16>(0))==0, "sg14::atan test failed");
+
+// result is confined to the range of the type
+static_assert(cos(fixed_point<std::int16_t, -15>(0))==std::numeric_limits<fixed_point<std::int16_t, -15>>::max(),
+        "sg14::cos test failed");
+
+////////////////////////////////////////////////////////////////////////////////
+// sg14::sqrt
+
+TEST(utils_tests, sqrt)
+{
+    // results are rounded down, including either side of every perfect square
+    for (auto n = std::uint32_t{2}; n < 65536; ++n) {
+        auto square = n*n;
+        ASSERT_EQ(sqrt(fixed_point<std::uint32_t>(square-1)), n-1);
+        ASSERT_EQ(sqrt(fixed_point<std::uint32_t>(square)), n);
+        ASSERT_EQ(sqrt(fixed_point<std::uint32_t>(square+1)), n);
+    }
+
+    ASSERT_EQ(sqrt(fixed_point<std::int32_t, -16>(2)), (fixed_point<std::int32_t, -16>::from_data(92681)));
+    ASSERT_EQ(sqrt(fixed_point<std::uint8_t, -4>(15.9375)), (fixed_point<std::uint8_t, -4>::from_data(63)));
+}
+
+static_assert(sqrt(fixed_point<std::uint32_t>(4294967295u))==65535u, "sg14::sqrt test failed");
+static_assert(sqrt(fixed_point<std::int16_t, -8>(100))==10, "sg14::sqrt test failed");
+
 ////////////////////////////////////////////////////////////////////////////////
 // sg14::abs
 
@@ -46,6 +147,90 @@ static_assert(abs(make_ufixed<8, 0>(66))==66, "sg14::abs test failed");
 static_assert(abs(make_ufixed<8, 0>(123))==123, "sg14::abs test failed");
 static_assert(abs(make_ufixed<8, 8>(5))==5, "sg14::abs test failed");
 
+////////////////////////////////////////////////////////////////////////////////
+// sg14::floor, sg14::ceil, sg14::trunc and sg14::round
+
+static_assert(floor(make_fixed<7, 8>(-2.5))==-3, "sg14::floor test failed");
+static_assert(ceil(make_fixed<7, 8>(-2.5))==-2, "sg14::ceil test failed");
+static_assert(trunc(make_fixed<7, 8>(-2.5))==-2, "sg14::trunc test failed");
+static_assert(round(make_fixed<7, 8>(-2.5))==-3, "sg14::round test failed");
+static_assert(round(make_fixed<7, 8>(2.5))==3, "sg14::round test failed");
+static_assert(round(make_ufixed<4, 4>(2.4375))==2, "sg14::round test failed");
+static_assert(floor(make_fixed<0, 15>(-.25))==-1, "sg14::floor test failed");
+static_assert(ceil(make_ufixed<0, 32>::from_data(0)).data()==0, "sg14::ceil test failed");
+static_assert(floor(make_fixed<15, -4>(-48))==-48, "sg14::floor test failed");
+
+////////////////////////////////////////////////////////////////////////////////
+// sg14::fmod, sg14::remainder and sg14::modf
+
+static_assert(fmod(make_fixed<7, 8>(-7.5), make_fixed<7, 8>(2))==-1.5, "sg14::fmod test failed");
+static_assert(remainder(make_fixed<7, 8>(-7.5), make_fixed<7, 8>(2))==.5, "sg14::remainder test failed");
+static_assert(remainder(make_fixed<7, 8>(5), make_fixed<7, 8>(2))==1, "sg14::remainder test failed");
+static_assert(remainder(make_fixed<7, 8>(7), make_fixed<7, 8>(2))==-1, "sg14::remainder test failed");
+static_assert(fmod(std::numeric_limits<fixed_point<int32_t, -16>>::lowest(), fixed_point<int32_t, -16>::from_data(-1))==0,
+        "sg14::fmod test failed");
+static_assert(remainder(std::numeric_limits<fixed_point<int64_t, -16>>::lowest(), fixed_point<int64_t, -16>::from_data(-1))==0,
+        "sg14::remainder test failed");
+static_assert(fmod(std::numeric_limits<fixed_point<int64_t, 0>>::lowest(), fixed_point<int64_t, 0>{-1})==0,
+        "sg14::fmod test failed");
+static_assert(fmod(fixed_point<uint32_t, -16>::from_data(5), fixed_point<uint32_t, -16>::from_data(UINT32_MAX))
+        ==fixed_point<uint32_t, -16>::from_data(5), "sg14::fmod test failed");
+#if (__cplusplus>=201402L)
+namespace {
+    constexpr fixed_point<int32_t, -16> modf_fraction(fixed_point<int32_t, -16> x)
+    {
+        auto integer_part = fixed_point<int32_t, -16>{};
+        return modf(x, &integer_part);
+    }
+}
+static_assert(modf_fraction(-2.75)==-.75, "sg14::modf test failed");
+#endif
+
+template<class FixedPoint>
+void test_rounding()
+{
+    using rep = typename FixedPoint::rep;
+    auto max = static_cast<double>(std::numeric_limits<FixedPoint>::max());
+    auto lowest = static_cast<double>(std::numeric_limits<FixedPoint>::lowest());
+    auto representable = [&](double d) { return d>=lowest && d<=max; };
+    auto divisor = FixedPoint{2.25};
+    for (auto data = static_cast<int>(std::numeric_limits<rep>::lowest());
+         data<=static_cast<int>(std::numeric_limits<rep>::max()); ++data) {
+        auto x = FixedPoint::from_data(static_cast<rep>(data));
+        auto d = static_cast<double>(x);
+        if (representable(std::floor(d))) {
+            ASSERT_EQ(static_cast<double>(floor(x)), std::floor(d)) << x;
+        }
+        if (representable(std::ceil(d))) {
+            ASSERT_EQ(static_cast<double>(ceil(x)), std::ceil(d)) << x;
+        }
+        if (representable(std::trunc(d))) {
+            ASSERT_EQ(static_cast<double>(trunc(x)), std::trunc(d)) << x;
+
+            auto integer_part = FixedPoint{};
+            auto fractional_part = modf(x, &integer_part);
+            ASSERT_EQ(static_cast<double>(integer_part), std::trunc(d)) << x;
+            ASSERT_EQ(static_cast<double>(fractional_part), d-std::trunc(d)) << x;
+        }
+        if (representable(std::round(d))) {
+            ASSERT_EQ(static_cast<double>(round(x)), std::round(d)) << x;
+        }
+        ASSERT_EQ(static_cast<double>(fmod(x, divisor)), std::fmod(d, static_cast<double>(divisor))) << x;
+        if (representable(std::remainder(d, static_cast<double>(divisor)))) {
+            ASSERT_EQ(static_cast<double>(remainder(x, divisor)), std::remainder(d, static_cast<double>(divisor))) << x;
+        }
+    }
+}
+
+TEST(utils_tests, rounding)
+{
+    test_rounding<fixed_point<std::int8_t, -4>>();
+    test_rounding<fixed_point<std::uint8_t, -3>>();
+    test_rounding<fixed_point<std::int16_t, -8>>();
+    test_rounding<fixed_point<std::uint16_t, -12>>();
+    test_rounding<fixed_point<std::int16_t, -14>>();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // std specializations for 128-bit integer facilitate certain 64-bit operations
 